@@ -0,0 +1,106 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/repeat_n.h"
+#include "sus/prelude.h"
+
+
+// Cycling a slice wraps an index into the slice rather than cloning the slice
+// iterator at the end of each pass, flattening a slice of `Vec` knows its exact
+// size, and `repeat_n()` knows its exact size, so each of these should be at
+// parity with the equivalent hand-written loop.
+
+namespace {
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+sus::Vec<sus::Vec<u32>> generate_nested(usize sz) {
+  auto data = sus::Vec<sus::Vec<u32>>::with_capacity(sz / 10u);
+  for (usize i; i < sz / 10u; i += 1u) data.push(generate_data(10u));
+  return data;
+}
+
+void cycles(ankerl::nanobench::Bench& b, usize num_elements) {
+  // A short slice is cycled through many times.
+  auto data = generate_data(7u);
+  const u32* const ptr = data.as_ptr();
+  const size_t n = data.len();
+  const size_t total = num_elements;
+
+  b.run(fmt::format("cycle loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u32;
+    for (size_t i = 0u, j = 0u; i < total; ++i) {
+      sum = sum.wrapping_add(ptr[j]);
+      if (++j == n) j = 0u;
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("cycle iter, n = {}", num_elements), [&]() {
+    auto sum = 0_u32;
+    auto it = data.iter().copied().cycle();
+    for (size_t i = 0u; i < total; ++i)
+      sum = sum.wrapping_add(it.next().unwrap());
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+}
+
+void repeats(ankerl::nanobench::Bench& b, usize num_elements) {
+  b.run(fmt::format("repeat loop, n = {}", num_elements), [&]() {
+    auto v = sus::Vec<u32>::with_capacity(num_elements);
+    for (usize i; i < num_elements; i += 1u) v.push(7u);
+    ankerl::nanobench::doNotOptimizeAway(v);
+  });
+  b.run(fmt::format("repeat_n collect, n = {}", num_elements), [&]() {
+    auto v = sus::iter::repeat_n(7_u32, num_elements).collect_vec();
+    ankerl::nanobench::doNotOptimizeAway(v);
+  });
+}
+
+void flattens(ankerl::nanobench::Bench& b, usize num_elements) {
+  auto data = generate_nested(num_elements);
+
+  b.run(fmt::format("flatten loop, n = {}", num_elements), [&]() {
+    auto v = sus::Vec<u32>();
+    for (const sus::Vec<u32>& each : data)
+      for (u32 i : each) v.push(i);
+    ankerl::nanobench::doNotOptimizeAway(v);
+  });
+  b.run(fmt::format("flatten collect, n = {}", num_elements), [&]() {
+    auto v = data.iter().flatten().copied().collect_vec();
+    ankerl::nanobench::doNotOptimizeAway(v);
+  });
+}
+
+}  // namespace
+
+TEST(BenchCycleFlatten, Cycle_100_000) {
+  auto b = ankerl::nanobench::Bench();
+  cycles(b, 100'000u);
+}
+TEST(BenchCycleFlatten, RepeatN_100_000) {
+  auto b = ankerl::nanobench::Bench();
+  repeats(b, 100'000u);
+}
+TEST(BenchCycleFlatten, Flatten_100_000) {
+  auto b = ankerl::nanobench::Bench();
+  flattens(b, 100'000u);
+}
@@ -0,0 +1,102 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/dyn_iterator.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+// A `DynIterator` makes an indirect call for each `next()`, but `fold()`, the
+// methods built on it, and `next_chunk()` pull elements through the type
+// erasure a chunk at a time. These benchmarks compare iterating through a
+// `DynIterator` with the concrete iterator it holds, whether the iterator is
+// held inline or on the heap.
+
+namespace {
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+auto filtered(const sus::Vec<u32>& data) {
+  return data.iter().filter([](const u32& i) { return i % 3u != 0u; });
+}
+using Filtered = decltype(filtered(std::declval<const sus::Vec<u32>&>()));
+
+void dyn_iteration(ankerl::nanobench::Bench& b, const sus::Vec<u32>& data,
+                   usize num_elements) {
+  b.run(fmt::format("concrete sum, n = {}", num_elements), [&]() {
+    auto sum =
+        filtered(data).fold(0_u64, [](u64 acc, u32 i) { return acc + i; });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("DynIterator next() loop, n = {}", num_elements), [&]() {
+    auto it = sus::iter::DynIterator<const u32&>::from(filtered(data));
+    auto sum = 0_u64;
+    for (u32 i : it) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("DynIterator fold(), n = {}", num_elements), [&]() {
+    auto sum = sus::iter::DynIterator<const u32&>::from(filtered(data)).fold(
+        0_u64, [](u64 acc, u32 i) { return acc + i; });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("DynIterator next_chunk<16>() loop, n = {}", num_elements),
+        [&]() {
+          auto it = sus::iter::DynIterator<u32>::from(filtered(data).copied());
+          auto sum = 0_u64;
+          while (true) {
+            auto chunk = it.next_chunk<16>();
+            if (chunk.is_err()) {
+              for (sus::Option<u32> o : sus::move(chunk).unwrap_err())
+                sum += o.unwrap_or(0u);
+              break;
+            }
+            for (u32 i : sus::move(chunk).unwrap()) sum += i;
+          }
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+  b.run(fmt::format("DynIterator on heap fold(), n = {}", num_elements),
+        [&]() {
+          auto it =
+              sus::iter::DynIterator<const u32&, 0u>::from(filtered(data));
+          auto sum =
+              sus::move(it).fold(0_u64, [](u64 acc, u32 i) { return acc + i; });
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
+
+static_assert(sus::iter::DynIterator<const u32&>::holds_inline<Filtered>());
+
+}  // namespace
+
+TEST(BenchDynIterator, DynIteration_1000) {
+  auto data = generate_data(1'000u);
+  auto b = ankerl::nanobench::Bench();
+  dyn_iteration(b, data, 1'000u);
+}
+TEST(BenchDynIterator, DynIteration_100_000) {
+  auto data = generate_data(100'000u);
+  auto b = ankerl::nanobench::Bench();
+  dyn_iteration(b, data, 100'000u);
+}
+TEST(BenchDynIterator, DynIteration_10_000_000) {
+  auto data = generate_data(10'000'000u);
+  auto b = ankerl::nanobench::Bench();
+  dyn_iteration(b, data, 10'000'000u);
+}
@@ -0,0 +1,138 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/zip.h"
+#include "sus/prelude.h"
+
+// Terminal operations like `sum()`, `count()` and `for_each()` are built on
+// `fold()`, which each adaptor passes through to the iterator it wraps. These
+// benchmarks compare them against the equivalent for-loop, and should be at
+// parity.
+
+namespace {
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+void fold_through_adaptors(ankerl::nanobench::Bench& b,
+                           const sus::Vec<u32>& data, usize num_elements) {
+  b.run(fmt::format("for loop map sum, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (u32 i : data.iter()) sum += u64::from(i) * 2u;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("iter().map().sum(), n = {}", num_elements), [&]() {
+    auto sum = data.iter().map([](u32 i) { return u64::from(i) * 2u; }).sum();
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for loop filter sum, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (u32 i : data.iter()) {
+      if (i % 3u == 0u) sum += u64::from(i);
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("iter().filter().fold(), n = {}", num_elements), [&]() {
+    auto sum = data.iter()
+                   .filter([](const u32& i) { return i % 3u == 0u; })
+                   .fold(0_u64, [](u64 acc, u32 i) { return acc + i; });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for loop over two, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (u32 i : data.iter()) sum += i;
+    for (u32 i : data.iter()) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("iter().chain().fold(), n = {}", num_elements), [&]() {
+    auto sum = data.iter().chain(data.iter()).fold(
+        0_u64, [](u64 acc, u32 i) { return acc + i; });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for loop zip, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (usize i; i < data.len(); i += 1u)
+      sum += u64::from(data[i]) * u64::from(data[i]);
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("zip().map().sum(), n = {}", num_elements), [&]() {
+    auto sum = sus::iter::zip(data.iter(), data.iter())
+                   .map([](auto pair) {
+                     auto [x, y] = pair;
+                     return u64::from(x) * u64::from(y);
+                   })
+                   .sum();
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for loop enumerate, n = {}", num_elements), [&]() {
+    auto sum = 0_usize;
+    usize idx;
+    for (u32 i : data.iter()) {
+      sum += idx ^ usize::from(i);
+      idx += 1u;
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("iter().enumerate().for_each(), n = {}", num_elements),
+        [&]() {
+          auto sum = 0_usize;
+          data.iter().enumerate().for_each([&](auto&& pair) {
+            auto [idx, i] = sus::move(pair);
+            sum += idx ^ usize::from(i);
+          });
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+
+  b.run(fmt::format("for loop count, n = {}", num_elements), [&]() {
+    auto count = 0_usize;
+    for (u32 i : data.iter()) {
+      if (i > 500u) count += 1u;
+    }
+    ankerl::nanobench::doNotOptimizeAway(count);
+  });
+  b.run(fmt::format("iter().filter().count(), n = {}", num_elements), [&]() {
+    auto count =
+        data.iter().filter([](const u32& i) { return i > 500u; }).count();
+    ankerl::nanobench::doNotOptimizeAway(count);
+  });
+}
+
+}  // namespace
+
+TEST(BenchFold, FoldThroughAdaptors_1000) {
+  auto data = generate_data(1'000u);
+  auto b = ankerl::nanobench::Bench();
+  fold_through_adaptors(b, data, 1'000u);
+}
+TEST(BenchFold, FoldThroughAdaptors_100_000) {
+  auto data = generate_data(100'000u);
+  auto b = ankerl::nanobench::Bench();
+  fold_through_adaptors(b, data, 100'000u);
+}
+TEST(BenchFold, FoldThroughAdaptors_10_000_000) {
+  auto data = generate_data(10'000'000u);
+  auto b = ankerl::nanobench::Bench();
+  fold_through_adaptors(b, data, 10'000'000u);
+}
@@ -0,0 +1,141 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+// Chains of `map()` and `filter()` are fused into a single adaptor over the
+// source iterator, holding one closure that calls each of the chained closures.
+// The size checks below fail to compile if a chain ever nests an adaptor for
+// each call again, and the benchmarks compare deep chains with the equivalent
+// hand-written loop, and should be at parity.
+
+namespace {
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+constexpr auto add = [](u32 i) { return i.wrapping_add(7u); };
+constexpr auto mul = [](u32 i) { return i.wrapping_mul(3u); };
+constexpr auto odd = [](const u32& i) { return i % 2u == 1u; };
+constexpr auto small = [](const u32& i) { return i < 2000u; };
+
+auto copied_iter(const sus::Vec<u32>& v) { return v.iter().copied(); }
+using Source = decltype(copied_iter(sus::Vec<u32>()));
+
+auto map_chain(const sus::Vec<u32>& v) {
+  return copied_iter(v).map(add).map(mul).map(add).map(mul).map(add);
+}
+auto filter_chain(const sus::Vec<u32>& v) {
+  return copied_iter(v).filter(odd).filter(small).filter(odd).filter(small);
+}
+auto mixed_chain(const sus::Vec<u32>& v) {
+  return copied_iter(v)
+      .map(add)
+      .filter(odd)
+      .map(mul)
+      .filter(small)
+      .map(add)
+      .map(mul);
+}
+
+// The closures are all empty, so each chain is no larger than a single adaptor
+// over the source iterator, which holds one closure next to the source.
+constexpr size_t AdaptorSize = sizeof(decltype(copied_iter(
+    sus::Vec<u32>()).map(add)));
+static_assert(sizeof(Source) < AdaptorSize);
+static_assert(sizeof(decltype(map_chain(sus::Vec<u32>()))) == AdaptorSize);
+static_assert(sizeof(decltype(filter_chain(sus::Vec<u32>()))) == AdaptorSize);
+static_assert(sizeof(decltype(mixed_chain(sus::Vec<u32>()))) == AdaptorSize);
+// A chain of `map()` keeps random access to the source.
+static_assert(sus::iter::__private::TrustedRandomAccess<
+              decltype(map_chain(sus::Vec<u32>()))>);
+
+void chains(ankerl::nanobench::Bench& b, const sus::Vec<u32>& data,
+            usize num_elements) {
+  const u32* const ptr = data.as_ptr();
+  const size_t n = data.len();
+
+  b.run(fmt::format("map loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u32;
+    for (size_t i = 0u; i < n; ++i)
+      sum = sum.wrapping_add(add(mul(add(mul(add(ptr[i]))))));
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("map chain, n = {}", num_elements), [&]() {
+    auto sum = map_chain(data).fold(
+        0_u32, [](u32 acc, u32 i) { return acc.wrapping_add(i); });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("filter loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u32;
+    for (size_t i = 0u; i < n; ++i) {
+      const u32 x = ptr[i];
+      if (odd(x) && small(x) && odd(x) && small(x)) sum = sum.wrapping_add(x);
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("filter chain, n = {}", num_elements), [&]() {
+    auto sum = filter_chain(data).fold(
+        0_u32, [](u32 acc, u32 i) { return acc.wrapping_add(i); });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("mixed loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u32;
+    for (size_t i = 0u; i < n; ++i) {
+      const u32 x = add(ptr[i]);
+      if (!odd(x)) continue;
+      const u32 y = mul(x);
+      if (!small(y)) continue;
+      sum = sum.wrapping_add(mul(add(y)));
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("mixed chain, n = {}", num_elements), [&]() {
+    auto sum = mixed_chain(data).fold(
+        0_u32, [](u32 acc, u32 i) { return acc.wrapping_add(i); });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("mixed chain next(), n = {}", num_elements), [&]() {
+    auto sum = 0_u32;
+    for (u32 i : mixed_chain(data)) sum = sum.wrapping_add(i);
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+}
+
+}  // namespace
+
+TEST(BenchFusion, Chains_1000) {
+  auto data = generate_data(1'000u);
+  auto b = ankerl::nanobench::Bench();
+  chains(b, data, 1'000u);
+}
+TEST(BenchFusion, Chains_100_000) {
+  auto data = generate_data(100'000u);
+  auto b = ankerl::nanobench::Bench();
+  chains(b, data, 100'000u);
+}
+TEST(BenchFusion, Chains_10_000_000) {
+  auto data = generate_data(10'000'000u);
+  auto b = ankerl::nanobench::Bench();
+  chains(b, data, 10'000'000u);
+}
@@ -0,0 +1,137 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/generator.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+// Compares a generator against the equivalent hand-written iterator, both for
+// a single long-running generator, where the cost is in resuming the coroutine
+// for each item, and for many short-lived generators, where the cost is in
+// allocating the coroutine frame. Frames come from a per-thread pool by
+// default, and from the global heap when `std::allocator` is given.
+
+namespace {
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+sus::iter::Generator<u32> evens(sus::Slice<u32> s) {
+  for (u32 i : s) {
+    if (i % 2u == 0u) co_yield i;
+  }
+}
+
+sus::iter::Generator<u32> evens_with_global_heap(std::allocator_arg_t,
+                                                 const std::allocator<u32>&,
+                                                 sus::Slice<u32> s) {
+  for (u32 i : s) {
+    if (i % 2u == 0u) co_yield i;
+  }
+}
+
+// The hand-written iterator equivalent to `evens()`.
+class Evens final : public sus::iter::IteratorBase<Evens, u32> {
+ public:
+  using Item = u32;
+
+  explicit Evens(sus::Slice<u32> s) : s_(s) {}
+
+  sus::Option<u32> next() noexcept {
+    while (i_ < s_.len()) {
+      u32 v = s_[i_];
+      i_ += 1u;
+      if (v % 2u == 0u) return sus::some(v);
+    }
+    return sus::none();
+  }
+  sus::iter::SizeHint size_hint() const noexcept {
+    return sus::iter::SizeHint(0u, sus::some(s_.len() - i_));
+  }
+
+ private:
+  sus::Slice<u32> s_;
+  usize i_;
+};
+
+void generators(ankerl::nanobench::Bench& b, const sus::Vec<u32>& data,
+                usize num_elements) {
+  b.run(fmt::format("for loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (u32 i : data.iter()) {
+      if (i % 2u == 0u) sum += i;
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("hand-written iterator, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (u32 i : Evens(data.as_slice())) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("generator, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (u32 i : evens(data.as_slice())) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  // A new iterator for every 16 elements.
+  b.run(fmt::format("hand-written iterator per 16, n = {}", num_elements),
+        [&]() {
+          auto sum = 0_u64;
+          for (sus::Slice<u32> chunk : data.chunks(16u)) {
+            for (u32 i : Evens(chunk)) sum += i;
+          }
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+  b.run(fmt::format("pooled generator per 16, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (sus::Slice<u32> chunk : data.chunks(16u)) {
+      for (u32 i : evens(chunk)) sum += i;
+    }
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("global heap generator per 16, n = {}", num_elements),
+        [&]() {
+          auto sum = 0_u64;
+          auto alloc = std::allocator<u32>();
+          for (sus::Slice<u32> chunk : data.chunks(16u)) {
+            for (u32 i : evens_with_global_heap(std::allocator_arg, alloc,
+                                                chunk)) {
+              sum += i;
+            }
+          }
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
+
+}  // namespace
+
+TEST(BenchGenerator, Generators_1000) {
+  auto data = generate_data(1'000u);
+  auto b = ankerl::nanobench::Bench();
+  generators(b, data, 1'000u);
+}
+TEST(BenchGenerator, Generators_100_000) {
+  auto data = generate_data(100'000u);
+  auto b = ankerl::nanobench::Bench();
+  generators(b, data, 100'000u);
+}
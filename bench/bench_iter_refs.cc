@@ -0,0 +1,116 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark is built multiple times with different iterator invalidation
+// modes, in order to compare the cost of the ref-counting each performs.
+
+#include <thread>
+#include <vector>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+namespace {
+
+constexpr const char* invalidation_mode() {
+#if defined(SUS_ITERATOR_INVALIDATION) && !SUS_ITERATOR_INVALIDATION
+  return "off";
+#elif SUS_ITERATOR_INVALIDATION_ATOMIC
+  return "atomic";
+#else
+  return "on";
+#endif
+}
+
+static sus::Vec<i32> generate_data(usize sz) {
+  auto data = sus::Vec<i32>::with_capacity(sz);
+  for (i32 i; i < i32::try_from(sz).unwrap(); i += 1) {
+    data.push(i % 128);
+  }
+  return data;
+}
+
+}  // namespace
+
+// Creating an iterator is where the ref-count is incremented, so iterate over
+// many short Vecs to measure the overhead.
+static void iterate_short_vecs(ankerl::nanobench::Bench& b,
+                               const sus::Vec<sus::Vec<i32>>& data,
+                               usize num_elements) {
+  b.run(fmt::format("Vec::iter() of short Vecs, invalidation {}, n = {}",
+                    invalidation_mode(), num_elements),
+        [&]() {
+          auto sum = 0_i32;
+          for (const sus::Vec<i32>& v : data.iter()) {
+            for (i32 i : v.iter()) sum = sum.wrapping_add(i);
+          }
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
+
+// With atomic ref-counts, the same Vec can be iterated from many threads at
+// once. This measures the contention on the shared ref-counts.
+#if (defined(SUS_ITERATOR_INVALIDATION) && !SUS_ITERATOR_INVALIDATION) || \
+    SUS_ITERATOR_INVALIDATION_ATOMIC
+static void iterate_short_vecs_on_threads(ankerl::nanobench::Bench& b,
+                                          const sus::Vec<sus::Vec<i32>>& data,
+                                          usize num_elements,
+                                          usize num_threads) {
+  b.run(fmt::format("Vec::iter() of short Vecs, invalidation {}, n = {}, "
+                    "threads = {}",
+                    invalidation_mode(), num_elements, num_threads),
+        [&]() {
+          std::vector<std::thread> threads;
+          for (usize t = 0u; t < num_threads; t += 1u) {
+            threads.emplace_back([&]() {
+              auto sum = 0_i32;
+              for (const sus::Vec<i32>& v : data.iter()) {
+                for (i32 i : v.iter()) sum = sum.wrapping_add(i);
+              }
+              ankerl::nanobench::doNotOptimizeAway(sum);
+            });
+          }
+          for (auto& t : threads) t.join();
+        });
+}
+
+TEST(BenchIterRefs, IterateShortVecsOnThreads_100_000) {
+  auto data = sus::Vec<sus::Vec<i32>>::with_capacity(100'000u);
+  for (usize i = 0u; i < 100'000u; i += 1u) data.push(generate_data(4u));
+  auto b = ankerl::nanobench::Bench();
+  iterate_short_vecs_on_threads(b, data, 100'000u, 4u);
+}
+#endif
+
+TEST(BenchIterRefs, IterateVec_10_000_000) {
+  auto data = generate_data(10'000'000u);
+  auto b = ankerl::nanobench::Bench();
+  b.run(fmt::format("Vec::iter(), invalidation {}, n = {}",
+                    invalidation_mode(), 10'000'000u),
+        [&]() {
+          auto sum = 0_i32;
+          for (i32 i : data.iter()) sum = sum.wrapping_add(i);
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
+
+TEST(BenchIterRefs, IterateShortVecs_100_000) {
+  auto data = sus::Vec<sus::Vec<i32>>::with_capacity(100'000u);
+  for (usize i = 0u; i < 100'000u; i += 1u) data.push(generate_data(4u));
+  auto b = ankerl::nanobench::Bench();
+  iterate_short_vecs(b, data, 100'000u);
+}
@@ -0,0 +1,115 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/array.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+// Pulling a fixed-size chunk from an iterator with `next_chunk()` builds the
+// array without checking each element for the end of the iteration, when the
+// iterator knows its remaining length or has random access to its elements.
+// These benchmarks compare pulling chunks with `next_chunk()` to filling the
+// same arrays one `next()` at a time.
+
+namespace {
+
+constexpr size_t Chunk = 8u;
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+// Sums the lanes of each chunk separately, which the compiler can vectorize.
+void add_lanes(sus::Array<u32, Chunk>& acc, const sus::Array<u32, Chunk>& c) {
+  for (usize i; i < Chunk; i += 1u) acc[i] = acc[i].wrapping_add(c[i]);
+}
+
+template <class Iter>
+sus::Array<u32, Chunk> sum_by_next(Iter it) {
+  auto acc = sus::Array<u32, Chunk>();
+  while (true) {
+    auto c = sus::Array<u32, Chunk>();
+    for (usize i; i < Chunk; i += 1u) {
+      Option<u32> o = it.next();
+      if (o.is_none()) return acc;
+      c[i] = sus::move(o).unwrap();
+    }
+    add_lanes(acc, c);
+  }
+}
+
+template <class Iter>
+sus::Array<u32, Chunk> sum_by_next_chunk(Iter it) {
+  auto acc = sus::Array<u32, Chunk>();
+  while (true) {
+    auto r = it.template next_chunk<Chunk>();
+    if (r.is_err()) return acc;
+    add_lanes(acc, sus::move(r).unwrap());
+  }
+}
+
+void chunks(ankerl::nanobench::Bench& b, const sus::Vec<u32>& data,
+            usize num_elements) {
+  b.run(fmt::format("copied next(), n = {}", num_elements), [&]() {
+    auto acc = sum_by_next(data.iter().copied());
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run(fmt::format("copied next_chunk(), n = {}", num_elements), [&]() {
+    auto acc = sum_by_next_chunk(data.iter().copied());
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+
+  auto map_fn = [](const u32& i) { return i.wrapping_mul(3u); };
+  b.run(fmt::format("map next(), n = {}", num_elements), [&]() {
+    auto acc = sum_by_next(data.iter().map(map_fn));
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run(fmt::format("map next_chunk(), n = {}", num_elements), [&]() {
+    auto acc = sum_by_next_chunk(data.iter().map(map_fn));
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+
+  // Both include cloning the Vec to be consumed.
+  b.run(fmt::format("into_iter next(), n = {}", num_elements), [&]() {
+    auto acc = sum_by_next(sus::clone(data).into_iter());
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run(fmt::format("into_iter next_chunk(), n = {}", num_elements), [&]() {
+    auto acc = sum_by_next_chunk(sus::clone(data).into_iter());
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+}
+
+}  // namespace
+
+TEST(BenchNextChunk, Chunks_1000) {
+  auto data = generate_data(1'000u);
+  auto b = ankerl::nanobench::Bench();
+  chunks(b, data, 1'000u);
+}
+TEST(BenchNextChunk, Chunks_100_000) {
+  auto data = generate_data(100'000u);
+  auto b = ankerl::nanobench::Bench();
+  chunks(b, data, 100'000u);
+}
+TEST(BenchNextChunk, Chunks_10_000_000) {
+  auto data = generate_data(10'000'000u);
+  auto b = ankerl::nanobench::Bench();
+  chunks(b, data, 10'000'000u);
+}
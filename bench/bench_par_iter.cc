@@ -0,0 +1,73 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/par/par_iter.h"
+#include "sus/prelude.h"
+
+namespace {
+
+sus::Vec<u32> make_vec(usize len) {
+  auto v = sus::Vec<u32>::with_capacity(len);
+  for (u32 i; i < u32::try_from(len).unwrap(); i += 1u) v.push(i);
+  return v;
+}
+
+u64 expensive(const u32& i) {
+  u64 x = u64::from(i);
+  for (usize j; j < 16u; j += 1u)
+    x = x.wrapping_mul(6364136223846793005u).wrapping_add(1u);
+  return x >> 33u;
+}
+
+}  // namespace
+
+TEST(BenchParIter, MapSum_10_000_000) {
+  auto b = ankerl::nanobench::Bench().minEpochIterations(10);
+  auto v = make_vec(10'000'000u);
+
+  u64 first_result;
+  u64 result;
+
+  b.run("iter().map().sum()", [&]() {
+    auto r = v.iter()
+                 .map([](const u32& i) { return u64::from(i) * 2u; })
+                 .sum<u64>();
+    ankerl::nanobench::doNotOptimizeAway(r);
+    first_result = r;
+  });
+  b.run("par_iter().map().sum()", [&]() {
+    auto r = v.par_iter()
+                 .map([](const u32& i) { return u64::from(i) * 2u; })
+                 .sum<u64>();
+    ankerl::nanobench::doNotOptimizeAway(r);
+    result = r;
+  });
+  EXPECT_EQ(result, first_result);
+
+  b.run("iter().map(expensive).sum()", [&]() {
+    auto r = v.iter().map(expensive).sum<u64>();
+    ankerl::nanobench::doNotOptimizeAway(r);
+    first_result = r;
+  });
+  b.run("par_iter().map(expensive).sum()", [&]() {
+    auto r = v.par_iter().map(expensive).sum<u64>();
+    ankerl::nanobench::doNotOptimizeAway(r);
+    result = r;
+  });
+  EXPECT_EQ(result, first_result);
+}
@@ -0,0 +1,118 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/ops/range.h"
+#include "sus/prelude.h"
+
+// A loop over a `Range` steps the range's bounds directly, without an overflow
+// check or an `Option` for each index, and `nth()`, `fold()` and friends are
+// specialized for it. These benchmarks compare indexing loops over a range with
+// the equivalent loop over a primitive integer, and should be at parity.
+
+namespace {
+
+sus::Vec<u32> generate_data(usize sz) {
+  auto data = sus::Vec<u32>::with_capacity(sz);
+  for (u32 i; i < u32::try_from(sz).unwrap(); i += 1u) data.push(i % 1000u);
+  return data;
+}
+
+void index_loops(ankerl::nanobench::Bench& b, const sus::Vec<u32>& data,
+                 usize num_elements) {
+  const size_t n = data.len();
+  // SAFETY: The indices are all less than `data.len()`.
+  auto at = [&data](usize i) -> u32 {
+    return data.get_unchecked(::sus::marker::unsafe_fn, i);
+  };
+
+  b.run(fmt::format("for size_t loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (size_t i = 0u; i < n; ++i) sum += at(i);
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("for range loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (usize i : sus::ops::range(0_usize, data.len())) sum += at(i);
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("range().for_each(), n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    sus::ops::range(0_usize, data.len()).for_each([&](usize i) {
+      sum += at(i);
+    });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for size_t sum, n = {}", num_elements), [&]() {
+    auto sum = 0_usize;
+    for (size_t i = 0u; i < n; ++i) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("range().sum(), n = {}", num_elements), [&]() {
+    auto sum = sus::ops::range(0_usize, data.len()).sum();
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for size_t reverse loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (size_t i = n; i > 0u; --i)
+      sum = sum.wrapping_mul(3u).wrapping_add(at(i - 1u));
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("range().rev().fold(), n = {}", num_elements), [&]() {
+    auto sum = sus::ops::range(0_usize, data.len())
+                   .rev()
+                   .fold(0_u64, [&](u64 acc, usize i) {
+                     return acc.wrapping_mul(3u).wrapping_add(at(i));
+                   });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for size_t step loop, n = {}", num_elements), [&]() {
+    auto sum = 0_u64;
+    for (size_t i = 0u; i < n; i += 7u) sum += at(i);
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("range().step_by().fold(), n = {}", num_elements),
+        [&]() {
+          auto sum = sus::ops::range(0_usize, data.len())
+                         .step_by(7u)
+                         .fold(0_u64, [&](u64 acc, usize i) {
+                           return acc + at(i);
+                         });
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
+
+}  // namespace
+
+TEST(BenchRange, IndexLoops_1000) {
+  auto data = generate_data(1'000u);
+  auto b = ankerl::nanobench::Bench();
+  index_loops(b, data, 1'000u);
+}
+TEST(BenchRange, IndexLoops_100_000) {
+  auto data = generate_data(100'000u);
+  auto b = ankerl::nanobench::Bench();
+  index_loops(b, data, 100'000u);
+}
+TEST(BenchRange, IndexLoops_10_000_000) {
+  auto data = generate_data(10'000'000u);
+  auto b = ankerl::nanobench::Bench();
+  index_loops(b, data, 10'000'000u);
+}
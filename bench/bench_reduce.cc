@@ -0,0 +1,112 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+// Reductions over a slice of primitive numbers are done in blocks across
+// several independent accumulators, with overflow checked once per block,
+// which lets the compiler vectorize them. These benchmarks compare them
+// against a for-loop that checks for overflow on each element.
+
+namespace {
+
+template <class T>
+sus::Vec<T> generate_data(usize sz) {
+  auto data = sus::Vec<T>::with_capacity(sz);
+  for (usize i; i < sz; i += 1u) data.push(T::try_from(i % 100u).unwrap());
+  return data;
+}
+
+sus::Vec<f32> generate_float_data(usize sz) {
+  auto data = sus::Vec<f32>::with_capacity(sz);
+  for (usize i; i < sz; i += 1u)
+    data.push(f32::from(u16::try_from(i % 100u).unwrap()));
+  return data;
+}
+
+template <class T>
+void reduce(ankerl::nanobench::Bench& b, const sus::Vec<T>& data,
+            std::string_view type, usize num_elements) {
+  b.run(fmt::format("for loop sum {}, n = {}", type, num_elements), [&]() {
+    auto sum = T();
+    for (const T& i : data.iter()) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("iter().sum() {}, n = {}", type, num_elements), [&]() {
+    auto sum = data.iter().sum();
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+
+  b.run(fmt::format("for loop min {}, n = {}", type, num_elements), [&]() {
+    auto min = T::MAX;
+    for (const T& i : data.iter()) {
+      if (i < min) min = i;
+    }
+    ankerl::nanobench::doNotOptimizeAway(min);
+  });
+  b.run(fmt::format("iter().min() {}, n = {}", type, num_elements), [&]() {
+    auto min = data.iter().min();
+    ankerl::nanobench::doNotOptimizeAway(min);
+  });
+
+  b.run(fmt::format("for loop max {}, n = {}", type, num_elements), [&]() {
+    auto max = T::MIN;
+    for (const T& i : data.iter()) {
+      if (i > max) max = i;
+    }
+    ankerl::nanobench::doNotOptimizeAway(max);
+  });
+  b.run(fmt::format("iter().max() {}, n = {}", type, num_elements), [&]() {
+    auto max = data.iter().max();
+    ankerl::nanobench::doNotOptimizeAway(max);
+  });
+}
+
+void reduce_float(ankerl::nanobench::Bench& b, const sus::Vec<f32>& data,
+                  usize num_elements) {
+  b.run(fmt::format("for loop sum f32, n = {}", num_elements), [&]() {
+    auto sum = 0_f32;
+    for (const f32& i : data.iter()) sum += i;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run(fmt::format("iter().sum() f32, n = {}", num_elements), [&]() {
+    auto sum = data.iter().sum();
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+}
+
+}  // namespace
+
+TEST(BenchReduce, Reduce_1000) {
+  auto b = ankerl::nanobench::Bench();
+  reduce(b, generate_data<i32>(1'000u), "i32", 1'000u);
+  reduce(b, generate_data<u64>(1'000u), "u64", 1'000u);
+  reduce_float(b, generate_float_data(1'000u), 1'000u);
+}
+TEST(BenchReduce, Reduce_100_000) {
+  auto b = ankerl::nanobench::Bench();
+  reduce(b, generate_data<i32>(100'000u), "i32", 100'000u);
+  reduce(b, generate_data<u64>(100'000u), "u64", 100'000u);
+  reduce_float(b, generate_float_data(100'000u), 100'000u);
+}
+TEST(BenchReduce, Reduce_10_000_000) {
+  auto b = ankerl::nanobench::Bench();
+  reduce(b, generate_data<i32>(10'000'000u), "i32", 10'000'000u);
+  reduce(b, generate_data<u64>(10'000'000u), "u64", 10'000'000u);
+  reduce_float(b, generate_float_data(10'000'000u), 10'000'000u);
+}
@@ -128,6 +128,27 @@ auto common_prefix_no_shortcircuit(sus::Slice<u8> xs,
   return result;
 }
 
+// The chunk size is known at compile time, so the comparison of each pair of
+// chunks can be unrolled without giving up the short-circuit, though each
+// chunk is copied into an Array.
+auto common_prefix_array_chunks(sus::Slice<u8> xs,
+                                sus::Slice<u8> ys) -> usize {
+  constexpr auto chunk_size = 16_usize;
+  auto result = 0_usize;
+  for (auto [xs_chunk, ys_chunk] :
+       zip(xs.iter().copied().array_chunks<16>(),
+           ys.iter().copied().array_chunks<16>())) {
+    if (xs_chunk != ys_chunk) break;
+    result += chunk_size;
+  }
+  for (auto [x, y] : zip(xs[sus::ops::range_from(result)],
+                         ys[sus::ops::range_from(result)])) {
+    if (x != y) break;
+    result += 1u;
+  }
+  return result;
+}
+
 auto common_prefix_take_while(sus::Slice<u8> xs,
                               sus::Slice<u8> ys) -> usize {
   constexpr auto chunk_size = 16_usize;
@@ -189,6 +210,13 @@ TEST(BenchSimdChunks, common_prefix) {
   });
   EXPECT_EQ(result, first_result);
 
+  b.run("common_prefix_array_chunks", [&]() {
+    auto r = common_prefix_array_chunks(v1, v2);
+    ankerl::nanobench::doNotOptimizeAway(r);
+    result = r;
+  });
+  EXPECT_EQ(result, first_result);
+
   b.run("common_prefix_take_while", [&]() {
     auto r = common_prefix_take_while(v1, v2);
     ankerl::nanobench::doNotOptimizeAway(r);
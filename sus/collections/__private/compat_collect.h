@@ -0,0 +1,45 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+
+namespace sus::collections::__private {
+
+/// Collects the items of `iter` into a sequence container, such as the one
+/// underlying a `std::stack` or `std::queue`. The container can reserve space
+/// for the items up front, which the adaptor around it can not.
+template <class Collection, class Iter>
+constexpr Collection collect_into_container(Iter&& iter) noexcept {
+  auto c = Collection();
+  if constexpr (requires { c.reserve(iter.size_hint().lower); })
+    c.reserve(iter.size_hint().lower);
+  for (auto&& t : iter) c.push_back(::sus::move(t));
+  return c;
+}
+
+/// Inserts into an ordered container, such as a `std::set` or `std::map`, at
+/// its end. When the items are inserted in sorted order, as they often are when
+/// collected, this is amortized constant time, and it is no worse than an
+/// unhinted insert otherwise.
+template <class Container, class... Args>
+constexpr void emplace_at_end(Container& c, Args&&... args) noexcept {
+  c.emplace_hint(c.end(), ::sus::forward<Args>(args)...);
+}
+
+}  // namespace sus::collections::__private
@@ -16,6 +16,7 @@
 
 #include <map>
 
+#include "sus/collections/__private/compat_collect.h"
 #include "sus/collections/compat_pair_concept.h"
 #include "sus/iter/from_iterator.h"
 #include "sus/iter/iterator.h"
@@ -36,8 +37,10 @@ struct sus::iter::FromIteratorImpl<std::map<Key, T, Compare, Allocator>> {
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = Self();
-    for (auto&& [key, t] : iter)
-      s.emplace(sus::forward<Key>(key), sus::forward<T>(t));
+    for (auto&& [key, t] : iter) {
+      sus::collections::__private::emplace_at_end(s, sus::forward<Key>(key),
+                                                  sus::forward<T>(t));
+    }
     return s;
   }
 };
@@ -57,8 +60,10 @@ struct sus::iter::FromIteratorImpl<std::multimap<Key, T, Compare, Allocator>> {
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = Self();
-    for (auto&& [key, t] : iter)
-      s.emplace(sus::forward<Key>(key), sus::forward<T>(t));
+    for (auto&& [key, t] : iter) {
+      sus::collections::__private::emplace_at_end(s, sus::forward<Key>(key),
+                                                  sus::forward<T>(t));
+    }
     return s;
   }
 };
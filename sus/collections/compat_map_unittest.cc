@@ -15,6 +15,7 @@
 #include "sus/collections/compat_map.h"
 
 #include <tuple>
+#include <vector>
 
 #include "googletest/include/gtest/gtest.h"
 #include "sus/iter/compat_ranges.h"
@@ -65,4 +66,36 @@ TEST(CompatMultiMap, FromIterator) {
              std::multimap<i32, u32>{{4, 5u}, {4, 4u}, {6, 7u}, {4, 6u}});
 }
 
+TEST(CompatMap, FromIteratorHint) {
+  // Inserting with a hint at the end gives the same map for sorted, reversed
+  // and unsorted input. When a key repeats, the first value is kept.
+  auto expected = std::map<i32, u32>{{1, 1u}, {2, 2u}, {3, 3u}, {4, 4u}};
+  auto sorted = std::vector<std::tuple<i32, u32>>{
+      {1, 1u}, {2, 2u}, {3, 3u}, {3, 9u}, {4, 4u}};
+  EXPECT_EQ((sus::iter::from_range(sus::move(sorted))
+                 .collect<std::map<i32, u32>>()),
+            expected);
+  auto reversed = std::vector<std::tuple<i32, u32>>{
+      {4, 4u}, {3, 3u}, {3, 9u}, {2, 2u}, {1, 1u}};
+  EXPECT_EQ((sus::iter::from_range(sus::move(reversed))
+                 .collect<std::map<i32, u32>>()),
+            expected);
+  auto unsorted = std::vector<std::tuple<i32, u32>>{
+      {3, 3u}, {1, 1u}, {4, 4u}, {3, 9u}, {2, 2u}};
+  EXPECT_EQ((sus::iter::from_range(sus::move(unsorted))
+                 .collect<std::map<i32, u32>>()),
+            expected);
+}
+
+TEST(CompatMultiMap, FromIteratorHint) {
+  // Equal keys keep the order they were collected in.
+  auto in = std::vector<std::tuple<i32, u32>>{
+      {2, 1u}, {1, 1u}, {2, 2u}, {3, 1u}, {1, 2u}, {2, 3u}};
+  auto out = sus::iter::from_range(sus::move(in))
+                 .collect<std::multimap<i32, u32>>();
+  auto values = std::vector<std::tuple<i32, u32>>(out.begin(), out.end());
+  EXPECT_EQ(values, (std::vector<std::tuple<i32, u32>>{
+                        {1, 1u}, {1, 2u}, {2, 1u}, {2, 2u}, {2, 3u}, {3, 1u}}));
+}
+
 }  // namespace
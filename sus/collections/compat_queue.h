@@ -16,6 +16,7 @@
 
 #include <queue>
 
+#include "sus/collections/__private/compat_collect.h"
 #include "sus/iter/from_iterator.h"
 #include "sus/iter/iterator.h"
 
@@ -25,10 +26,9 @@ struct sus::iter::FromIteratorImpl<std::queue<T, Collection>> {
       ::sus::iter::IntoIterator<T> auto&& into_iter) noexcept
     requires(sus::mem::IsMoveRef<decltype(into_iter)>)
   {
-    auto&& iter = sus::move(into_iter).into_iter();
-    auto v = std::queue<T, Collection>();
-    for (T&& t : iter) v.push(::sus::move(t));
-    return v;
+    return std::queue<T, Collection>(
+        ::sus::collections::__private::collect_into_container<Collection>(
+            sus::move(into_iter).into_iter()));
   }
 };
 
@@ -39,9 +39,11 @@ struct sus::iter::FromIteratorImpl<
       ::sus::iter::IntoIterator<T> auto&& into_iter) noexcept
     requires(sus::mem::IsMoveRef<decltype(into_iter)>)
   {
-    auto&& iter = sus::move(into_iter).into_iter();
-    auto v = std::priority_queue<T, Collection, Compare>();
-    for (T&& t : iter) v.push(::sus::move(t));
-    return v;
+    // The heap is built once in linear time, instead of pushing each element
+    // onto the heap.
+    return std::priority_queue<T, Collection, Compare>(
+        Compare(),
+        ::sus::collections::__private::collect_into_container<Collection>(
+            sus::move(into_iter).into_iter()));
   }
 };
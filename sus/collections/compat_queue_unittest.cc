@@ -14,6 +14,9 @@
 
 #include "sus/collections/compat_queue.h"
 
+#include <functional>
+#include <vector>
+
 #include "googletest/include/gtest/gtest.h"
 #include "sus/iter/compat_ranges.h"
 #include "sus/prelude.h"
@@ -82,4 +85,74 @@ TEST(CompatPriorityQueue, FromIteratorRef) {
   sus_check(out.empty() && cmp.empty());
 }
 
+TEST(CompatQueue, FromIteratorReserves) {
+  auto in = sus::Vec<i32>();
+  for (i32 i; i < 100; i += 1) in.push(i);
+  // Exposes the underlying container of the queue.
+  struct Queue : public std::queue<i32, std::vector<i32>> {
+    using std::queue<i32, std::vector<i32>>::c;
+  };
+  auto out = Queue(sus::move(in).into_iter()
+                       .collect<std::queue<i32, std::vector<i32>>>());
+  // The underlying container is sized once from the `size_hint()`.
+  EXPECT_EQ(out.c.capacity(), 100u);
+  EXPECT_EQ(out.size(), 100u);
+  EXPECT_EQ(out.front(), 0);
+  EXPECT_EQ(out.back(), 99);
+  auto expected = std::vector<i32>();
+  for (i32 i; i < 100; i += 1) expected.push_back(i);
+  EXPECT_EQ(out.c, expected);
+}
+
+TEST(CompatQueue, FromIteratorDeque) {
+  auto in = sus::Vec<i32>();
+  for (i32 i; i < 100; i += 1) in.push(i);
+  auto out = sus::move(in).into_iter().collect<std::queue<i32>>();
+  // Elements come out in the order they were collected.
+  for (i32 i; i < 100; i += 1) {
+    EXPECT_EQ(out.front(), i);
+    out.pop();
+  }
+  EXPECT_TRUE(out.empty());
+}
+
+TEST(CompatPriorityQueue, FromIteratorHeapify) {
+  // Unsorted input, with duplicates, so the heap has to be built.
+  auto in = sus::Vec<i32>();
+  for (i32 i; i < 100; i += 1) in.push((i * 37) % 50);
+  // Exposes the underlying container of the priority queue.
+  struct Queue : public std::priority_queue<i32> {
+    using std::priority_queue<i32>::c;
+  };
+  auto out =
+      Queue(sus::move(in).into_iter().collect<std::priority_queue<i32>>());
+  // The underlying container is sized once from the `size_hint()`.
+  EXPECT_EQ(out.c.capacity(), 100u);
+  EXPECT_EQ(out.size(), 100u);
+  // Pops from largest to smallest, with each value appearing twice.
+  for (i32 i = 49; i >= 0; i -= 1) {
+    EXPECT_EQ(out.top(), i);
+    out.pop();
+    EXPECT_EQ(out.top(), i);
+    out.pop();
+  }
+  EXPECT_TRUE(out.empty());
+}
+
+TEST(CompatPriorityQueue, FromIteratorHeapifyCompare) {
+  auto in = sus::Vec<i32>(5, 1, 4, 2, 3, 2);
+  auto out = sus::move(in)
+                 .into_iter()
+                 .collect<std::priority_queue<i32, std::vector<i32>,
+                                              std::greater<i32>>>();
+  // The heap is built with the `Compare` type, so pops from smallest to
+  // largest.
+  auto popped = std::vector<i32>();
+  while (!out.empty()) {
+    popped.push_back(out.top());
+    out.pop();
+  }
+  EXPECT_EQ(popped, (std::vector<i32>{1, 2, 2, 3, 4, 5}));
+}
+
 }  // namespace
@@ -16,6 +16,7 @@
 
 #include <set>
 
+#include "sus/collections/__private/compat_collect.h"
 #include "sus/iter/compat_ranges.h"
 #include "sus/iter/from_iterator.h"
 #include "sus/iter/iterator.h"
@@ -28,7 +29,8 @@ struct sus::iter::FromIteratorImpl<std::set<Key, Compare, Allocator>> {
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = std::set<Key, Compare, Allocator>();
-    for (Key k : iter) s.insert(k);
+    for (Key&& k : iter)
+      ::sus::collections::__private::emplace_at_end(s, ::sus::move(k));
     return s;
   }
 };
@@ -41,7 +43,8 @@ struct sus::iter::FromIteratorImpl<std::multiset<Key, Compare, Allocator>> {
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = std::multiset<Key, Compare, Allocator>();
-    for (Key k : iter) s.insert(k);
+    for (Key&& k : iter)
+      ::sus::collections::__private::emplace_at_end(s, ::sus::move(k));
     return s;
   }
 };
@@ -14,6 +14,9 @@
 
 #include "sus/collections/compat_set.h"
 
+#include <memory>
+#include <vector>
+
 #include "googletest/include/gtest/gtest.h"
 #include "sus/iter/compat_ranges.h"
 #include "sus/option/option.h"
@@ -44,4 +47,39 @@ TEST(CompaMultiSet, FromIterator) {
   sus_check(out == std::multiset<i32>{2, 2, 2, 4, 6});
 }
 
+TEST(CompatSet, FromIteratorHint) {
+  // Inserting with a hint at the end gives the same set for sorted, reversed
+  // and unsorted input.
+  auto expected = std::set<i32>{1, 2, 3, 4, 5};
+  auto sorted = std::vector<i32>{1, 2, 3, 3, 4, 5};
+  auto out_sorted =
+      sus::iter::from_range(sorted).moved(unsafe_fn).collect<std::set<i32>>();
+  EXPECT_EQ(out_sorted, expected);
+  auto reversed = std::vector<i32>{5, 4, 3, 3, 2, 1};
+  auto out_reversed =
+      sus::iter::from_range(reversed).moved(unsafe_fn).collect<std::set<i32>>();
+  EXPECT_EQ(out_reversed, expected);
+  auto unsorted = std::vector<i32>{3, 1, 5, 3, 2, 4};
+  auto out_unsorted =
+      sus::iter::from_range(unsorted).moved(unsafe_fn).collect<std::set<i32>>();
+  EXPECT_EQ(out_unsorted, expected);
+}
+
+TEST(CompatSet, FromIteratorMovesKeys) {
+  auto in = std::vector<std::unique_ptr<i32>>();
+  in.push_back(std::make_unique<i32>(1));
+  in.push_back(std::make_unique<i32>(2));
+  auto out = sus::iter::from_range(in)
+                 .moved(unsafe_fn)
+                 .collect<std::set<std::unique_ptr<i32>>>();
+  EXPECT_EQ(out.size(), 2u);
+}
+
+TEST(CompaMultiSet, FromIteratorHint) {
+  auto in = std::vector<i32>{3, 1, 2, 3, 1, 3};
+  auto out =
+      sus::iter::from_range(in).moved(unsafe_fn).collect<std::multiset<i32>>();
+  EXPECT_EQ(out, (std::multiset<i32>{1, 1, 2, 3, 3, 3}));
+}
+
 }  // namespace
@@ -16,6 +16,7 @@
 
 #include <stack>
 
+#include "sus/collections/__private/compat_collect.h"
 #include "sus/iter/from_iterator.h"
 #include "sus/iter/iterator.h"
 
@@ -25,9 +26,8 @@ struct sus::iter::FromIteratorImpl<std::stack<T, Collection>> {
       ::sus::iter::IntoIterator<T> auto&& into_iter) noexcept
     requires(sus::mem::IsMoveRef<decltype(into_iter)>)
   {
-    auto&& iter = sus::move(into_iter).into_iter();
-    auto v = std::stack<T, Collection>();
-    for (T&& t : iter) v.push(::sus::move(t));
-    return v;
+    return std::stack<T, Collection>(
+        ::sus::collections::__private::collect_into_container<Collection>(
+            sus::move(into_iter).into_iter()));
   }
 };
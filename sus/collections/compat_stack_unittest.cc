@@ -14,6 +14,8 @@
 
 #include "sus/collections/compat_stack.h"
 
+#include <vector>
+
 #include "googletest/include/gtest/gtest.h"
 #include "sus/iter/compat_ranges.h"
 #include "sus/prelude.h"
@@ -44,4 +46,23 @@ TEST(CompatStack, FromIteratorRef) {
   sus_check(out == std::stack<i32>(std::deque<i32>{6, 4, 2}));
 }
 
+TEST(CompatStack, FromIteratorReserves) {
+  auto in = sus::Vec<i32>();
+  for (i32 i; i < 100; i += 1) in.push(i);
+  // Exposes the underlying container of the stack.
+  struct Stack : public std::stack<i32, std::vector<i32>> {
+    using std::stack<i32, std::vector<i32>>::c;
+  };
+  auto out = Stack(sus::move(in).into_iter()
+                       .collect<std::stack<i32, std::vector<i32>>>());
+  // The underlying container is sized once from the `size_hint()`.
+  EXPECT_EQ(out.c.capacity(), 100u);
+  EXPECT_EQ(out.size(), 100u);
+  for (i32 i = 99; i >= 0; i -= 1) {
+    EXPECT_EQ(out.top(), i);
+    out.pop();
+  }
+  EXPECT_TRUE(out.empty());
+}
+
 }  // namespace
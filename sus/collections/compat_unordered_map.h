@@ -38,6 +38,7 @@ struct sus::iter::FromIteratorImpl<
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = Self();
+    s.reserve(iter.size_hint().lower);
     for (auto&& [key, t] : iter)
       s.emplace(sus::forward<Key>(key), sus::forward<T>(t));
     return s;
@@ -60,6 +61,7 @@ struct sus::iter::FromIteratorImpl<
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = Self();
+    s.reserve(iter.size_hint().lower);
     for (auto&& [key, t] : iter)
       s.emplace(sus::forward<Key>(key), sus::forward<T>(t));
     return s;
@@ -41,6 +41,19 @@ TEST(CompatUnorderedMap, FromIterator) {
   sus_check(out == std::unordered_map<i32, u32>{{4, 5u}, {6, 7u}});
 }
 
+TEST(CompatUnorderedMap, FromIteratorReserves) {
+  auto in = std::vector<std::tuple<i32, u32>>();
+  for (i32 i; i < 1000; i += 1) in.emplace_back(i, 0u);
+  // The map is sized once from the `size_hint()` instead of growing as
+  // elements are inserted.
+  auto reserved = std::unordered_map<i32, u32>();
+  reserved.reserve(1000u);
+  auto out = sus::iter::from_range(sus::move(in))
+                 .collect<std::unordered_map<i32, u32>>();
+  EXPECT_EQ(out.size(), 1000u);
+  EXPECT_EQ(out.bucket_count(), reserved.bucket_count());
+}
+
 TEST(CompatUnorderedMap, FromIteratorSusTuple) {
   auto in =
       std::vector<sus::Tuple<i32, u32>>{sus::tuple(3, 4u), sus::tuple(4, 5u),
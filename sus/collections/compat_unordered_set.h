@@ -29,7 +29,8 @@ struct sus::iter::FromIteratorImpl<
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = std::unordered_set<Key, Hash, KeyEqual, Allocator>();
-    for (Key k : iter) s.insert(k);
+    s.reserve(iter.size_hint().lower);
+    for (Key&& k : iter) s.insert(::sus::move(k));
     return s;
   }
 };
@@ -43,7 +44,8 @@ struct sus::iter::FromIteratorImpl<
   {
     auto&& iter = sus::move(into_iter).into_iter();
     auto s = std::unordered_multiset<Key, Hash, KeyEqual, Allocator>();
-    for (Key k : iter) s.insert(k);
+    s.reserve(iter.size_hint().lower);
+    for (Key&& k : iter) s.insert(::sus::move(k));
     return s;
   }
 };
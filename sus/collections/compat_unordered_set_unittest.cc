@@ -68,4 +68,32 @@ TEST(CompatUnorderedMultiSet, FromIterator) {
   sus_check(out == std::unordered_multiset<i32>{2, 2, 2, 4, 6});
 }
 
+TEST(CompatUnorderedSet, FromIteratorReserves) {
+  auto in = std::vector<i32>();
+  for (i32 i; i < 1000; i += 1) in.push_back(i);
+  // The set is sized once from the `size_hint()` instead of growing as
+  // elements are inserted.
+  auto reserved = std::unordered_set<i32>();
+  reserved.reserve(1000u);
+  auto out = sus::iter::from_range(in)
+                 .moved(unsafe_fn)
+                 .collect<std::unordered_set<i32>>();
+  EXPECT_EQ(out.bucket_count(), reserved.bucket_count());
+  EXPECT_EQ(out.size(), 1000u);
+  for (i32 i; i < 1000; i += 1) EXPECT_EQ(out.count(i), 1u);
+}
+
+TEST(CompatUnorderedMultiSet, FromIteratorReserves) {
+  auto in = std::vector<i32>();
+  for (i32 i; i < 1000; i += 1) in.push_back(i % 500);
+  auto reserved = std::unordered_multiset<i32>();
+  reserved.reserve(1000u);
+  auto out = sus::iter::from_range(in)
+                 .moved(unsafe_fn)
+                 .collect<std::unordered_multiset<i32>>();
+  EXPECT_EQ(out.bucket_count(), reserved.bucket_count());
+  EXPECT_EQ(out.size(), 1000u);
+  for (i32 i; i < 500; i += 1) EXPECT_EQ(out.count(i), 2u);
+}
+
 }  // namespace
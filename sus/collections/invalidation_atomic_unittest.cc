@@ -0,0 +1,79 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This test is built into its own binary with SUS_ITERATOR_INVALIDATION_ATOMIC
+// enabled.
+static_assert(SUS_ITERATOR_INVALIDATION_ATOMIC == 1);
+
+#include <thread>
+#include <vector>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/array.h"
+#include "sus/collections/slice.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+using sus::Array;
+using sus::Slice;
+using sus::Vec;
+
+namespace {
+
+constexpr usize round_up(usize n, usize multiple) {
+  if (n % multiple == 0u) return n;
+  return n + multiple - ((n + multiple) % multiple);
+}
+
+// The atomic ref-counts do not change the size of collections.
+static_assert(sizeof(Array<i32, 5>) ==
+              round_up(sizeof(i32) * 5 + sizeof(usize*), alignof(usize*)));
+static_assert(sizeof(Slice<i32>) ==
+              round_up(sizeof(i32*) + sizeof(usize) + sizeof(usize*),
+                       alignof(usize*)));
+
+TEST(IterRefAtomic, IterateOnThreads) {
+  auto v = Vec<i32>::with_capacity(1000u);
+  for (i32 i : sus::ops::range(0_i32, 1000_i32)) v.push(i);
+
+  constexpr usize kThreads = 8u;
+  auto sums = Vec<i32>();
+  for (usize i : sus::ops::range(0_usize, kThreads)) {
+    (void)i;
+    sums.push(0);
+  }
+
+  {
+    std::vector<std::thread> threads;
+    for (usize t : sus::ops::range(0_usize, kThreads)) {
+      threads.emplace_back([&v, out = &sums[t]]() {
+        for (usize _ : sus::ops::range(0_usize, 100_usize)) {
+          (void)_;
+          auto sum = 0_i32;
+          for (i32 i : v.iter()) sum += i;
+          *out = sum;
+        }
+      });
+    }
+    for (auto& t : threads) t.join();
+  }
+
+  for (i32 s : sums.iter()) EXPECT_EQ(s, 999 * 1000 / 2);
+  // All the iterators have been released, so the Vec can be mutated again.
+  v.push(1000);
+  EXPECT_EQ(v.len(), 1001u);
+}
+
+}  // namespace
@@ -27,6 +27,7 @@
 #include "sus/mem/clone.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
 #include "sus/num/unsigned_integer.h"
 
 namespace sus::collections {
@@ -67,6 +68,36 @@ struct [[nodiscard]] ArrayIntoIter final
     }
   }
 
+  /// sus::iter::Iterator trait.
+  ///
+  /// Moves the next `M` items out of the Array at once, without checking
+  /// each one for the end of the iteration.
+  template <size_t M>
+  constexpr ::sus::result::Result<Array<Item, M>, Array<Option<Item>, M>>
+  next_chunk() noexcept {
+    using Chunk = Array<Item, M>;
+    using Partial = Array<Option<Item>, M>;
+    using Out = ::sus::result::Result<Chunk, Partial>;
+    if (back_index_ - front_index_ >= M) {
+      // SAFETY: There are at least `M` items between the front and back
+      // indices, which are kept within the length of the Array.
+      return Out(Chunk::with_initializer([this]() {
+        return move(array_.get_unchecked_mut(
+            ::sus::marker::unsafe_fn,
+            ::sus::mem::replace(front_index_, front_index_ + 1_usize)));
+      }));
+    }
+    Partial partial;
+    for (usize i; front_index_ < back_index_; i += 1u) {
+      // SAFETY: Fewer than `M` items remain, so `i < M`.
+      partial.get_unchecked_mut(::sus::marker::unsafe_fn, i) =
+          Option<Item>(move(array_.get_unchecked_mut(
+              ::sus::marker::unsafe_fn,
+              ::sus::mem::replace(front_index_, front_index_ + 1_usize))));
+    }
+    return Out::with_err(::sus::move(partial));
+  }
+
   /// sus::iter::Iterator trait.
   constexpr ::sus::iter::SizeHint size_hint() const noexcept {
     ::sus::num::usize remaining = back_index_ - front_index_;
@@ -0,0 +1,176 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/collections/slice.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/iterator_ref.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/macros/no_unique_address.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/unsigned_integer.h"
+
+namespace sus::collections {
+
+/// An iterator over a slice in (non-overlapping) chunks, separated by a
+/// predicate.
+///
+/// This struct is created by the `chunk_by()` method on slices.
+template <class ItemT, ::sus::fn::FnMut<bool(const ItemT&, const ItemT&)> Pred>
+class [[nodiscard]] ChunkBy final
+    : public ::sus::iter::IteratorBase<ChunkBy<ItemT, Pred>,
+                                       ::sus::collections::Slice<ItemT>> {
+ public:
+  // `Item` is a `Slice<T>`.
+  using Item = ::sus::collections::Slice<ItemT>;
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (v_.is_empty()) return Option<Item>();
+    usize len = 1u;
+    while (len < v_.len() &&
+           ::sus::fn::call_mut(
+               pred_, v_.get_unchecked(::sus::marker::unsafe_fn, len - 1u),
+               v_.get_unchecked(::sus::marker::unsafe_fn, len))) {
+      len += 1u;
+    }
+    auto [head, tail] = v_.split_at_unchecked(::sus::marker::unsafe_fn, len);
+    v_ = tail;
+    return Option<Item>(head);
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> next_back() noexcept {
+    if (v_.is_empty()) return Option<Item>();
+    usize start = v_.len() - 1u;
+    while (start > 0u &&
+           ::sus::fn::call_mut(
+               pred_, v_.get_unchecked(::sus::marker::unsafe_fn, start - 1u),
+               v_.get_unchecked(::sus::marker::unsafe_fn, start))) {
+      start -= 1u;
+    }
+    auto [head, tail] = v_.split_at_unchecked(::sus::marker::unsafe_fn, start);
+    v_ = head;
+    return Option<Item>(tail);
+  }
+
+  // Replace the default impl in sus::iter::IteratorBase.
+  constexpr ::sus::iter::SizeHint size_hint() const noexcept {
+    if (v_.is_empty()) {
+      return {0u, ::sus::Option<::sus::num::usize>(0u)};
+    } else {
+      // Every element may be in its own chunk, or all in a single one.
+      return {1u, ::sus::Option<::sus::num::usize>(v_.len())};
+    }
+  }
+
+ private:
+  // Constructed by Slice, Vec, Array.
+  friend class Slice<ItemT>;
+  friend class Vec<ItemT>;
+  template <class ArrayItemT, size_t N>
+  friend class Array;
+
+  constexpr ChunkBy(::sus::iter::IterRef ref, const Slice<ItemT>& values,
+                    Pred&& pred) noexcept
+      : ref_(::sus::move(ref)), v_(values), pred_(::sus::move(pred)) {}
+
+  [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
+  Slice<ItemT> v_;
+  Pred pred_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(ref_), decltype(v_),
+                                           decltype(pred_));
+};
+
+/// An iterator over a slice in (non-overlapping) mutable chunks, separated by
+/// a predicate.
+///
+/// This struct is created by the `chunk_by_mut()` method on slices.
+template <class ItemT, ::sus::fn::FnMut<bool(const ItemT&, const ItemT&)> Pred>
+class [[nodiscard]] ChunkByMut final
+    : public ::sus::iter::IteratorBase<ChunkByMut<ItemT, Pred>,
+                                       ::sus::collections::SliceMut<ItemT>> {
+ public:
+  // `Item` is a `SliceMut<T>`.
+  using Item = ::sus::collections::SliceMut<ItemT>;
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (v_.is_empty()) return Option<Item>();
+    usize len = 1u;
+    while (len < v_.len() &&
+           ::sus::fn::call_mut(
+               pred_, v_.get_unchecked(::sus::marker::unsafe_fn, len - 1u),
+               v_.get_unchecked(::sus::marker::unsafe_fn, len))) {
+      len += 1u;
+    }
+    auto [head, tail] =
+        v_.split_at_mut_unchecked(::sus::marker::unsafe_fn, len);
+    v_ = tail;
+    return Option<Item>(head);
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> next_back() noexcept {
+    if (v_.is_empty()) return Option<Item>();
+    usize start = v_.len() - 1u;
+    while (start > 0u &&
+           ::sus::fn::call_mut(
+               pred_, v_.get_unchecked(::sus::marker::unsafe_fn, start - 1u),
+               v_.get_unchecked(::sus::marker::unsafe_fn, start))) {
+      start -= 1u;
+    }
+    auto [head, tail] =
+        v_.split_at_mut_unchecked(::sus::marker::unsafe_fn, start);
+    v_ = head;
+    return Option<Item>(tail);
+  }
+
+  // Replace the default impl in sus::iter::IteratorBase.
+  constexpr ::sus::iter::SizeHint size_hint() const noexcept {
+    if (v_.is_empty()) {
+      return {0u, ::sus::Option<::sus::num::usize>(0u)};
+    } else {
+      // Every element may be in its own chunk, or all in a single one.
+      return {1u, ::sus::Option<::sus::num::usize>(v_.len())};
+    }
+  }
+
+ private:
+  // Constructed by SliceMut, Vec, Array.
+  friend class SliceMut<ItemT>;
+  friend class Vec<ItemT>;
+  template <class ArrayItemT, size_t N>
+  friend class Array;
+
+  constexpr ChunkByMut(::sus::iter::IterRef ref, const SliceMut<ItemT>& values,
+                       Pred&& pred) noexcept
+      : ref_(::sus::move(ref)), v_(values), pred_(::sus::move(pred)) {}
+
+  [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
+  SliceMut<ItemT> v_;
+  Pred pred_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(ref_), decltype(v_),
+                                           decltype(pred_));
+};
+
+}  // namespace sus::collections
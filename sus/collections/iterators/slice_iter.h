@@ -16,19 +16,28 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <type_traits>
 
+#include "sus/cmp/ord.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/adaptors/prefetch.h"
 #include "sus/iter/iterator_defn.h"
 #include "sus/iter/iterator_ref.h"
 #include "sus/lib/__private/forward_decl.h"
 #include "sus/macros/no_unique_address.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/addressof.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/replace.h"
+#include "sus/num/__private/contiguous_reduce.h"
+#include "sus/num/integer_concepts.h"
 #include "sus/num/signed_integer.h"
 #include "sus/num/unsigned_integer.h"
+#include "sus/ops/try.h"
 #include "sus/ptr/nonnull.h"
 
 namespace sus::collections {
@@ -48,6 +57,10 @@ struct [[nodiscard]] [[_sus_trivial_abi]] SliceIter final
   static_assert(std::is_const_v<std::remove_reference_t<Item>>);
   // `RawItem` is a `T`.
   using RawItem = std::remove_const_t<std::remove_reference_t<Item>>;
+  // Whether the items are integers, which can be compared with vectorized
+  // loops.
+  static constexpr bool IntegerItem =
+      std::is_integral_v<RawItem> || ::sus::num::Integer<RawItem>;
 
  public:
   explicit constexpr SliceIter(::sus::iter::IterRef ref, const RawItem* start,
@@ -105,6 +118,147 @@ struct [[nodiscard]] [[_sus_trivial_abi]] SliceIter final
     return {};
   }
 
+  /// sus::iter::ContiguousIterator trait.
+  /// #[doc.hidden]
+  constexpr const RawItem* contiguous_data(
+      ::sus::marker::UnsafeFnMarker) const noexcept {
+    return ptr_;
+  }
+
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept {
+    // SAFETY: The caller ensures that `i < exact_size_hint()`, so `ptr_ + i` is
+    // inside the allocation.
+    return *(ptr_ + i);
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept {
+    // SAFETY: The caller ensures that `n <= exact_size_hint()`, so `ptr_ + n`
+    // is at most `end_`.
+    ptr_ += n;
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Folds the items in a single loop over the slice, rather than through
+  /// `next()`.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      for (const RawItem* p = ptr_; p != end_; p += 1u)
+        out = ::sus::mem::addressof(::sus::fn::call_mut(f, *out, *p));
+      return *out;
+    } else {
+      for (const RawItem* p = ptr_; p != end_; p += 1u)
+        init = ::sus::fn::call_mut(f, ::sus::move(init), *p);
+      return init;
+    }
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B rfold(B init, F f) && noexcept {
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      for (const RawItem* p = end_; p != ptr_;) {
+        p -= 1u;
+        out = ::sus::mem::addressof(::sus::fn::call_mut(f, *out, *p));
+      }
+      return *out;
+    } else {
+      for (const RawItem* p = end_; p != ptr_;) {
+        p -= 1u;
+        init = ::sus::fn::call_mut(f, ::sus::move(init), *p);
+      }
+      return init;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    while (ptr_ != end_) {
+      R out = ::sus::fn::call_mut(f, ::sus::move(init),
+                                  *::sus::mem::replace(ptr_, ptr_ + 1u));
+      if (!::sus::ops::try_is_success(out)) return out;
+      init = ::sus::ops::try_into_output(::sus::move(out));
+    }
+    return ::sus::ops::try_from_output<R>(::sus::move(init));
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// The number of items in the slice is known, so they are not iterated.
+  constexpr usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// For a slice of integers, the minimum value is found with a loop that the
+  /// compiler can vectorize.
+  constexpr Option<Item> min() && noexcept
+    requires(::sus::cmp::Ord<Item>)
+  {
+    if constexpr (IntegerItem) {
+      if (ptr_ == end_) return Option<Item>();
+      const auto m = ::sus::num::__private::contiguous_min(
+          ptr_, size_t{exact_size_hint()});
+      // The first of several equal minimum items is returned.
+      const RawItem* p = ptr_;
+      while (::sus::num::__private::reduce_value(*p) != m) p += 1u;
+      return Option<Item>(*p);
+    } else {
+      return static_cast<::sus::iter::IteratorBase<SliceIter, Item>&&>(*this)
+          .min();
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// For a slice of integers, the maximum value is found with a loop that the
+  /// compiler can vectorize.
+  constexpr Option<Item> max() && noexcept
+    requires(::sus::cmp::Ord<Item>)
+  {
+    if constexpr (IntegerItem) {
+      if (ptr_ == end_) return Option<Item>();
+      const auto m = ::sus::num::__private::contiguous_max(
+          ptr_, size_t{exact_size_hint()});
+      // The last of several equal maximum items is returned.
+      const RawItem* p = end_ - 1u;
+      while (::sus::num::__private::reduce_value(*p) != m) p -= 1u;
+      return Option<Item>(*p);
+    } else {
+      return static_cast<::sus::iter::IteratorBase<SliceIter, Item>&&>(*this)
+          .max();
+    }
+  }
+
+  /// Creates an iterator which prefetches the items `distance` elements ahead
+  /// of each item it yields.
+  ///
+  /// The items ahead are found directly in the slice, without cloning the
+  /// iterator. To prefetch memory that the items point to, use
+  /// [`prefetch_by`]($sus::iter::IteratorBase::prefetch_by) instead.
+  constexpr ::sus::iter::Iterator<Item> auto prefetch(
+      usize distance) && noexcept {
+    using PrefetchContiguous = ::sus::iter::PrefetchContiguous<SliceIter>;
+    return PrefetchContiguous(::sus::move(*this), distance);
+  }
+
  private:
   [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
   const RawItem* ptr_;
@@ -133,6 +287,10 @@ struct [[_sus_trivial_abi]] SliceIterMut final
   static_assert(!std::is_const_v<std::remove_reference_t<Item>>);
   // `RawItem` is a `T`.
   using RawItem = std::remove_reference_t<Item>;
+  // Whether the items are integers, which can be compared with vectorized
+  // loops.
+  static constexpr bool IntegerItem =
+      std::is_integral_v<RawItem> || ::sus::num::Integer<RawItem>;
 
  public:
   explicit constexpr SliceIterMut(::sus::iter::IterRef ref, RawItem* start,
@@ -196,6 +354,147 @@ struct [[_sus_trivial_abi]] SliceIterMut final
     return {};
   }
 
+  /// sus::iter::ContiguousIterator trait.
+  /// #[doc.hidden]
+  constexpr const RawItem* contiguous_data(
+      ::sus::marker::UnsafeFnMarker) const noexcept {
+    return ptr_;
+  }
+
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept {
+    // SAFETY: The caller ensures that `i < exact_size_hint()`, so `ptr_ + i` is
+    // inside the allocation.
+    return *(ptr_ + i);
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept {
+    // SAFETY: The caller ensures that `n <= exact_size_hint()`, so `ptr_ + n`
+    // is at most `end_`.
+    ptr_ += n;
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Folds the items in a single loop over the slice, rather than through
+  /// `next()`.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      for (RawItem* p = ptr_; p != end_; p += 1u)
+        out = ::sus::mem::addressof(::sus::fn::call_mut(f, *out, *p));
+      return *out;
+    } else {
+      for (RawItem* p = ptr_; p != end_; p += 1u)
+        init = ::sus::fn::call_mut(f, ::sus::move(init), *p);
+      return init;
+    }
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B rfold(B init, F f) && noexcept {
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      for (RawItem* p = end_; p != ptr_;) {
+        p -= 1u;
+        out = ::sus::mem::addressof(::sus::fn::call_mut(f, *out, *p));
+      }
+      return *out;
+    } else {
+      for (RawItem* p = end_; p != ptr_;) {
+        p -= 1u;
+        init = ::sus::fn::call_mut(f, ::sus::move(init), *p);
+      }
+      return init;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    while (ptr_ != end_) {
+      R out = ::sus::fn::call_mut(f, ::sus::move(init),
+                                  *::sus::mem::replace(ptr_, ptr_ + 1u));
+      if (!::sus::ops::try_is_success(out)) return out;
+      init = ::sus::ops::try_into_output(::sus::move(out));
+    }
+    return ::sus::ops::try_from_output<R>(::sus::move(init));
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// The number of items in the slice is known, so they are not iterated.
+  constexpr usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// For a slice of integers, the minimum value is found with a loop that the
+  /// compiler can vectorize.
+  constexpr Option<Item> min() && noexcept
+    requires(::sus::cmp::Ord<Item>)
+  {
+    if constexpr (IntegerItem) {
+      if (ptr_ == end_) return Option<Item>();
+      const auto m = ::sus::num::__private::contiguous_min(
+          ptr_, size_t{exact_size_hint()});
+      // The first of several equal minimum items is returned.
+      RawItem* p = ptr_;
+      while (::sus::num::__private::reduce_value(*p) != m) p += 1u;
+      return Option<Item>(*p);
+    } else {
+      return static_cast<::sus::iter::IteratorBase<SliceIterMut, Item>&&>(*this)
+          .min();
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// For a slice of integers, the maximum value is found with a loop that the
+  /// compiler can vectorize.
+  constexpr Option<Item> max() && noexcept
+    requires(::sus::cmp::Ord<Item>)
+  {
+    if constexpr (IntegerItem) {
+      if (ptr_ == end_) return Option<Item>();
+      const auto m = ::sus::num::__private::contiguous_max(
+          ptr_, size_t{exact_size_hint()});
+      // The last of several equal maximum items is returned.
+      RawItem* p = end_ - 1u;
+      while (::sus::num::__private::reduce_value(*p) != m) p -= 1u;
+      return Option<Item>(*p);
+    } else {
+      return static_cast<::sus::iter::IteratorBase<SliceIterMut, Item>&&>(*this)
+          .max();
+    }
+  }
+
+  /// Creates an iterator which prefetches the items `distance` elements ahead
+  /// of each item it yields.
+  ///
+  /// The items ahead are found directly in the slice, without cloning the
+  /// iterator. To prefetch memory that the items point to, use
+  /// [`prefetch_by`]($sus::iter::IteratorBase::prefetch_by) instead.
+  constexpr ::sus::iter::Iterator<Item> auto prefetch(
+      usize distance) && noexcept {
+    using PrefetchContiguous = ::sus::iter::PrefetchContiguous<SliceIterMut>;
+    return PrefetchContiguous(::sus::move(*this), distance);
+  }
+
  private:
   [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
   RawItem* ptr_;
@@ -18,14 +18,17 @@
 
 #include <stdint.h>
 
+#include <memory>
 #include <type_traits>
 
+#include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
 #include "sus/iter/size_hint.h"
 #include "sus/lib/__private/forward_decl.h"
 #include "sus/marker/unsafe.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
 #include "sus/num/unsigned_integer.h"
 
 namespace sus::collections {
@@ -61,6 +64,36 @@ struct [[nodiscard]] VecIntoIter final
     return Option<Item>(move(item));
   }
 
+  /// sus::iter::Iterator trait.
+  ///
+  /// Moves the next `M` items out of the Vec at once, without checking
+  /// each one for the end of the iteration.
+  template <size_t M>
+  constexpr ::sus::result::Result<Array<Item, M>, Array<Option<Item>, M>>
+  next_chunk() noexcept {
+    using Chunk = Array<Item, M>;
+    using Partial = Array<Option<Item>, M>;
+    using Out = ::sus::result::Result<Chunk, Partial>;
+    if (back_index_ - front_index_ >= M) {
+      // SAFETY: There are at least `M` items between the front and back
+      // indices, which are kept within the length of the Vec.
+      return Out(Chunk::with_initializer([this]() {
+        return move(vec_.get_unchecked_mut(
+            ::sus::marker::unsafe_fn,
+            ::sus::mem::replace(front_index_, front_index_ + 1_usize)));
+      }));
+    }
+    Partial partial;
+    for (usize i; front_index_ < back_index_; i += 1u) {
+      // SAFETY: Fewer than `M` items remain, so `i < M`.
+      partial.get_unchecked_mut(::sus::marker::unsafe_fn, i) =
+          Option<Item>(move(vec_.get_unchecked_mut(
+              ::sus::marker::unsafe_fn,
+              ::sus::mem::replace(front_index_, front_index_ + 1_usize))));
+    }
+    return Out::with_err(::sus::move(partial));
+  }
+
   /// sus::iter::DoubleEndedIterator trait.
   constexpr Option<Item> next_back() noexcept {
     if (front_index_ == back_index_) [[unlikely]]
@@ -92,6 +125,39 @@ struct [[nodiscard]] VecIntoIter final
     return {};
   }
 
+  /// sus::iter::InPlaceSource trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::InPlaceSourceMarker in_place_source()
+      const noexcept {
+    return {};
+  }
+  /// sus::iter::InPlaceSource trait.
+  /// #[doc.hidden]
+  template <class U, class F>
+    requires(::sus::iter::__private::InPlaceSource<VecIntoIter, U>)
+  Vec<U> map_collect_in_place(::sus::marker::UnsafeFnMarker,
+                              F& f) && noexcept {
+    auto [ptr, len, cap] = ::sus::move(vec_).into_raw_parts();
+    // The items before `front_index_` have been moved from already. They are
+    // destroyed first so their slots can be reused.
+    if constexpr (!std::is_trivially_destructible_v<Item>)
+      std::destroy(ptr, ptr + size_t{front_index_});
+    U* const out = reinterpret_cast<U*>(ptr);
+    // Each item is written at or before the slot that it was mapped from, which
+    // has been destroyed already.
+    usize written;
+    for (usize i = front_index_; i < back_index_; i += 1u) {
+      U u = ::sus::fn::call_mut(f, ::sus::move(ptr[size_t{i}]));
+      std::destroy_at(ptr + size_t{i});
+      std::construct_at(out + size_t{written}, ::sus::move(u));
+      written += 1u;
+    }
+    // The items after `back_index_` have been moved from already.
+    if constexpr (!std::is_trivially_destructible_v<Item>)
+      std::destroy(ptr + size_t{back_index_}, ptr + size_t{len});
+    return Vec<U>::from_raw_parts(::sus::marker::unsafe_fn, out, written, cap);
+  }
+
  private:
   // Ctor for Clone.
   constexpr VecIntoIter(Vec<Item>&& vec, usize front, usize back) noexcept
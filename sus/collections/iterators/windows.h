@@ -20,10 +20,15 @@
 ///
 /// This struct is created by the `windows()` method on slices.
 
+#include <stddef.h>
+
+#include <utility>
+
 #include "sus/iter/iterator_defn.h"
 #include "sus/iter/iterator_ref.h"
 #include "sus/lib/__private/forward_decl.h"
 #include "sus/macros/no_unique_address.h"
+#include "sus/mem/copy.h"
 #include "sus/mem/relocate.h"
 #include "sus/num/unsigned_integer.h"
 #include "sus/ops/range.h"
@@ -186,4 +191,86 @@ class [[nodiscard]] [[_sus_trivial_abi]] WindowsMut final
                                   decltype(v_), decltype(size_));
 };
 
+/// An iterator over overlapping windows of `N` elements, where each window is
+/// an [`Array`]($sus::collections::Array) of `N` elements copied from the
+/// slice.
+///
+/// This struct is created by the `array_windows()` method on slices.
+template <class ItemT, size_t N>
+class [[nodiscard]] [[_sus_trivial_abi]] ArrayWindows final
+    : public ::sus::iter::IteratorBase<ArrayWindows<ItemT, N>,
+                                       ::sus::collections::Array<ItemT, N>> {
+  static_assert(N > 0u);
+  static_assert(::sus::mem::Copy<ItemT>);
+
+ public:
+  // `Item` is an `Array<T, N>`.
+  using Item = ::sus::collections::Array<ItemT, N>;
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (N > v_.len()) return Option<Item>();
+    auto ret = Option<Item>(window_at(0u));
+    v_ = v_[::sus::ops::RangeFrom<usize>(1u)];
+    return ret;
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> next_back() noexcept {
+    if (N > v_.len()) return Option<Item>();
+    auto ret = Option<Item>(window_at(v_.len() - N));
+    v_ = v_[::sus::ops::RangeTo<usize>(v_.len() - 1u)];
+    return ret;
+  }
+
+  // Replace the default impl in sus::iter::IteratorBase.
+  constexpr ::sus::iter::SizeHint size_hint() const noexcept {
+    const auto remaining = exact_size_hint();
+    return {remaining, ::sus::Option<::sus::num::usize>(remaining)};
+  }
+
+  /// sus::iter::ExactSizeIterator trait.
+  constexpr ::sus::num::usize exact_size_hint() const noexcept {
+    if (N > v_.len()) {
+      return 0u;
+    } else {
+      return v_.len() - N + 1u;
+    }
+  }
+
+  /// Returns the elements at the end of the original slice which do not begin
+  /// a window, as there are fewer than `N` elements from there to the end of
+  /// the slice. These are the last `N - 1` elements, or the whole slice if it
+  /// is shorter than `N`.
+  [[nodiscard]] constexpr Slice<ItemT> remainder() const& { return rem_; }
+
+ private:
+  // Constructed by Slice, Vec.
+  friend class Slice<ItemT>;
+  friend class Vec<ItemT>;
+
+  constexpr ArrayWindows(::sus::iter::IterRef ref,
+                         const Slice<ItemT>& values) noexcept
+      : ref_(::sus::move(ref)),
+        v_(values),
+        rem_(values[::sus::ops::RangeFrom<usize>(
+            values.len() >= N ? values.len() - (N - 1u) : 0_usize)]) {}
+
+  /// Copies the `N` elements starting at `start` into an `Array`. The size is
+  /// known at compile time, so the copy can be unrolled.
+  constexpr Item window_at(usize start) const noexcept {
+    const ItemT* p = v_.as_ptr() + start;
+    return [p]<size_t... Is>(std::index_sequence<Is...>) {
+      return Item(*(p + Is)...);
+    }(std::make_index_sequence<N>());
+  }
+
+  [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
+  Slice<ItemT> v_;
+  Slice<ItemT> rem_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(ref_),
+                                  decltype(v_), decltype(rem_));
+};
+
 }  // namespace sus::collections
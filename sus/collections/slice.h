@@ -23,6 +23,7 @@
 #include "sus/cmp/ord.h"
 #include "sus/collections/__private/sort.h"
 #include "sus/collections/concat.h"
+#include "sus/collections/iterators/chunk_by.h"
 #include "sus/collections/iterators/chunks.h"
 #include "sus/collections/iterators/slice_iter.h"
 #include "sus/collections/iterators/split.h"
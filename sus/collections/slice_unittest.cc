@@ -339,6 +339,44 @@ TEST(Slice, IterMut) {
   EXPECT_EQ(sum, 9_usize);
 }
 
+TEST(Slice, IterPrefetch) {
+  usize ar[] = {1u, 2u, 3u, 4u, 5u};
+  {
+    auto slice = Slice<usize>::from(ar);
+    auto it = slice.iter().prefetch(2u);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(5u, sus::some(5u)));
+    auto sum = 0_usize;
+    for (const usize& i : it) sum += i;
+    EXPECT_EQ(sum, 15_usize);
+  }
+  {
+    auto slice = SliceMut<usize>::from(ar);
+    for (usize& i : slice.iter_mut().prefetch(2u)) i += 1u;
+    EXPECT_EQ(slice.iter().copied().fold(0_usize, [](usize a, usize b) {
+      return a + b;
+    }), 20_usize);
+  }
+  // The distance can reach past the end of the slice.
+  {
+    auto slice = Slice<usize>::from(ar);
+    auto it = slice.iter().prefetch(usize::MAX);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const usize&>);
+    EXPECT_EQ(it.next().copied(), sus::some(2u));
+    EXPECT_EQ(it.exact_size_hint(), 4u);
+    auto c = it.clone();
+    EXPECT_EQ(sus::move(it).copied().collect_vec(),
+              sus::Vec<usize>(3u, 4u, 5u, 6u));
+    EXPECT_EQ(sus::move(c).copied().collect_vec(),
+              sus::Vec<usize>(3u, 4u, 5u, 6u));
+  }
+  {
+    auto slice = Slice<usize>::from(ar);
+    auto it = slice.iter().prefetch(0u);
+    EXPECT_EQ(sus::move(it).copied().collect_vec(),
+              sus::Vec<usize>(2u, 3u, 4u, 5u, 6u));
+  }
+}
+
 TEST(Slice, IntoIter) {
   {
     const usize ar[] = {1u, 2u, 3u};
@@ -745,6 +783,56 @@ TEST(SliceMut, SortUnstableByKey) {
   }
 }
 
+TEST(SliceMut, PartialSort) {
+  auto v = sus::Vec<i32>(7, 3, 9, 1, 8, 2, 6, 5, 4);
+  v.partial_sort(3u);
+  EXPECT_EQ(v[0u], 1);
+  EXPECT_EQ(v[1u], 2);
+  EXPECT_EQ(v[2u], 3);
+  // The rest are all still present, in some order.
+  auto rest = v["3..9"_r].to_vec();
+  rest.sort();
+  EXPECT_EQ(rest, sus::Vec<i32>(4, 5, 6, 7, 8, 9));
+
+  // The whole slice is sorted when `k` is too large.
+  v.as_mut_slice().partial_sort(100u);
+  EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+
+  // Nothing happens when `k` is 0 or the slice is empty.
+  auto u = sus::Vec<i32>(3, 2, 1);
+  u.partial_sort(0u);
+  EXPECT_EQ(u, sus::Vec<i32>(3, 2, 1));
+  auto e = sus::Vec<i32>();
+  e.partial_sort(2u);
+  EXPECT_EQ(e.len(), 0u);
+}
+
+TEST(SliceMut, PartialSortBy) {
+  auto v = sus::Array<i32, 6>(3, 4, 2, 1, 6, 5);
+  // Sorts backward.
+  v.as_mut_slice().partial_sort_by(
+      2u, [](const i32& a, const i32& b) { return b <=> a; });
+  EXPECT_EQ(v[0u], 6);
+  EXPECT_EQ(v[1u], 5);
+
+  struct Unsortable {
+    i32 sortable;
+  };
+  auto u = sus::Vec<Unsortable>(Unsortable(3), Unsortable(4), Unsortable(2),
+                                Unsortable(1), Unsortable(6), Unsortable(5));
+  u.partial_sort_by_key(
+      2u, [](const Unsortable& u) -> i32 { return u.sortable; });
+  EXPECT_EQ(u[0u].sortable, 1);
+  EXPECT_EQ(u[1u].sortable, 2);
+
+  // partial_sort_by_key() is constexpr like the other partial sorts.
+  static_assert([] {
+    auto a = sus::Array<i32, 5>(2, 5, 1, 4, 3);
+    a.as_mut_slice().partial_sort_by_key(2u, [](const i32& i) { return -i; });
+    return a[0u] == 5 && a[1u] == 4;
+  }());
+}
+
 static_assert(sus::construct::Default<Slice<i32>>);
 static_assert(sus::construct::Default<SliceMut<i32>>);
 
@@ -981,6 +1069,63 @@ TEST(Slice, BinarySearchByKey) {
   }
 }
 
+TEST(Slice, ChunkBy) {
+  auto v = sus::Vec<i32>(1, 1, 1, 3, 3, 2, 2, 2);
+  sus::Slice<i32> s = v.as_slice();
+
+  auto it = s.chunk_by([](const i32& a, const i32& b) { return a == b; });
+  static_assert(sus::iter::Iterator<decltype(it), sus::Slice<i32>>);
+  static_assert(sus::iter::DoubleEndedIterator<decltype(it), sus::Slice<i32>>);
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(8u)));
+  EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(1, 1, 1));
+  EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(3, 3));
+  EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(2, 2, 2));
+  EXPECT_EQ(it.next(), sus::None);
+
+  // Sorted runs, from the back.
+  auto w = sus::Vec<i32>(1, 1, 2, 3, 2, 3, 2, 3, 4);
+  auto rit = w.chunk_by([](const i32& a, const i32& b) { return a <= b; });
+  EXPECT_EQ(rit.next_back().unwrap(), sus::Vec<i32>(2, 3, 4));
+  EXPECT_EQ(rit.next_back().unwrap(), sus::Vec<i32>(2, 3));
+  EXPECT_EQ(rit.next().unwrap(), sus::Vec<i32>(1, 1, 2, 3));
+  EXPECT_EQ(rit.next_back(), sus::None);
+
+  // Each run is a subslice of the original.
+  auto chunks = s.chunk_by([](const i32& a, const i32& b) { return a == b; })
+                    .collect_vec();
+  EXPECT_EQ(chunks.len(), 3u);
+  EXPECT_EQ(chunks[0u].as_ptr(), s.as_ptr());
+  EXPECT_EQ(chunks[1u].as_ptr(), s.as_ptr() + 3u);
+  EXPECT_EQ(chunks[2u].as_ptr(), s.as_ptr() + 5u);
+
+  // Empty and single element slices.
+  auto e = sus::Vec<i32>();
+  auto eit = e.chunk_by([](const i32&, const i32&) { return true; });
+  EXPECT_EQ(eit.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+  EXPECT_EQ(eit.next(), sus::None);
+  auto one = sus::Vec<i32>(5);
+  auto oit = one.chunk_by([](const i32&, const i32&) { return false; });
+  EXPECT_EQ(oit.next().unwrap(), sus::Vec<i32>(5));
+  EXPECT_EQ(oit.next(), sus::None);
+}
+
+TEST(SliceMut, ChunkByMut) {
+  auto v = sus::Vec<i32>(1, 1, 1, 3, 3, 2, 2, 2);
+  auto it = v.chunk_by_mut([](const i32& a, const i32& b) { return a == b; });
+  static_assert(sus::iter::Iterator<decltype(it), sus::SliceMut<i32>>);
+  for (sus::SliceMut<i32> run : it) {
+    // Number each element of the run.
+    for (usize i; i < run.len(); i += 1u) run[i] = i32::try_from(i).unwrap();
+  }
+  EXPECT_EQ(v, sus::Vec<i32>(0, 1, 2, 0, 1, 0, 1, 2));
+
+  auto rit = v.chunk_by_mut([](const i32& a, const i32& b) { return a < b; });
+  EXPECT_EQ(rit.next_back().unwrap(), sus::Vec<i32>(0, 1, 2));
+  EXPECT_EQ(rit.next_back().unwrap(), sus::Vec<i32>(0, 1));
+  EXPECT_EQ(rit.next_back().unwrap(), sus::Vec<i32>(0, 1, 2));
+  EXPECT_EQ(rit.next_back(), sus::None);
+}
+
 TEST(Slice, Chunks) {
   auto v = sus::Vec<i32>(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
   auto s = v.as_slice();
@@ -5882,6 +6027,54 @@ TEST(Slice, Windows) {
   EXPECT_EQ(w7.next(), sus::None);
 }
 
+TEST(Slice, ArrayWindows) {
+  auto v = sus::Vec<i32>(0, 1, 2, 3, 4, 5, 6, 7);
+  sus::Slice<i32> s = v.as_slice();
+
+  // Larger than the slice size.
+  {
+    auto w9 = s.array_windows<9>();
+    EXPECT_EQ(w9.exact_size_hint(), 0u);
+    EXPECT_EQ(w9.next(), sus::None);
+    EXPECT_EQ(w9.remainder(), s);
+  }
+
+  // Equal to the slice size.
+  {
+    auto w8 = s.array_windows<8>();
+    EXPECT_EQ(w8.next().unwrap(), (sus::Array<i32, 8>(0, 1, 2, 3, 4, 5, 6, 7)));
+    EXPECT_EQ(w8.next(), sus::None);
+    EXPECT_EQ(w8.remainder(), sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7));
+  }
+
+  auto w1 = s.array_windows<1>();
+  static_assert(
+      std::same_as<decltype(w1.next()), sus::Option<sus::Array<i32, 1>>>);
+  EXPECT_EQ(w1.remainder().len(), 0u);
+  for (i32 i; i < 8; i += 1)
+    EXPECT_EQ(w1.next().unwrap(), (sus::Array<i32, 1>(i)));
+  EXPECT_EQ(w1.next(), sus::None);
+
+  auto w3 = s.array_windows<3>();
+  EXPECT_EQ(w3.size_hint(), sus::iter::SizeHint(6u, sus::some(6u)));
+  EXPECT_EQ(w3.next().unwrap(), (sus::Array<i32, 3>(0, 1, 2)));
+  EXPECT_EQ(w3.next_back().unwrap(), (sus::Array<i32, 3>(5, 6, 7)));
+  EXPECT_EQ(w3.next().unwrap(), (sus::Array<i32, 3>(1, 2, 3)));
+  EXPECT_EQ(w3.exact_size_hint(), 3u);
+  EXPECT_EQ(w3.next().unwrap(), (sus::Array<i32, 3>(2, 3, 4)));
+  EXPECT_EQ(w3.next_back().unwrap(), (sus::Array<i32, 3>(4, 5, 6)));
+  EXPECT_EQ(w3.next().unwrap(), (sus::Array<i32, 3>(3, 4, 5)));
+  EXPECT_EQ(w3.next(), sus::None);
+  EXPECT_EQ(w3.next_back(), sus::None);
+  EXPECT_EQ(w3.remainder(), sus::Vec<i32>(6, 7));
+
+  // From a Vec.
+  auto sums = v.array_windows<2>()
+                  .map([](sus::Array<i32, 2> a) { return a[0u] + a[1u]; })
+                  .collect<sus::Vec<i32>>();
+  EXPECT_EQ(sums, sus::Vec<i32>(1, 3, 5, 7, 9, 11, 13));
+}
+
 TEST(SliceMut, WindowsMut) {
   auto v = sus::Vec<i32>(0, 1, 2, 3, 4, 5, 6, 7);
   sus::SliceMut<i32> s = v.as_mut_slice();
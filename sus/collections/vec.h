@@ -693,6 +693,21 @@ class Vec final {
     return VecIntoIter<T>(::sus::move(*this));
   }
 
+  /// Consumes the `Vec` into a parallel iterator that will return ownership of
+  /// each element.
+  ///
+  /// The elements are split into pieces which are iterated concurrently on a
+  /// work-stealing thread pool. Include "sus/iter/par/par_iter.h" to use the
+  /// returned [`ParIter`]($sus::iter::par::ParIter).
+  constexpr ::sus::iter::par::ParIter<::sus::iter::par::__private::VecSource<T>>
+  into_par_iter() && noexcept
+    requires(::sus::mem::Move<T>)
+  {
+    sus_check(!is_moved_from());
+    return ::sus::iter::par::ParIter<::sus::iter::par::__private::VecSource<T>>(
+        ::sus::iter::par::__private::VecSource<T>(::sus::move(*this)));
+  }
+
   /// Satisfies the [`Eq<Vec<T>, Vec<U>>`]($sus::cmp::Eq) concept.
   ///
   /// #[doc.overloads=vec.eq.vec]
@@ -1063,6 +1078,19 @@ struct sus::iter::FromIteratorImpl<::sus::collections::Vec<T>> {
     requires(::sus::mem::Move<T> &&  //
              ::sus::mem::IsMoveRef<decltype(ii)>)
   {
+    // Mapping the items of a `Vec` to a type of the same size and alignment
+    // reuses its allocation.
+    if constexpr (requires {
+                    {
+                      ::sus::move(ii).collect_vec_in_place(
+                          ::sus::marker::unsafe_fn)
+                    } -> std::same_as<::sus::collections::Vec<T>>;
+                  }) {
+      if (!std::is_constant_evaluated()) {
+        // SAFETY: This is not a constant expression.
+        return ::sus::move(ii).collect_vec_in_place(::sus::marker::unsafe_fn);
+      }
+    }
     auto v = ::sus::collections::Vec<T>();
     v.extend(::sus::move(ii));
     return v;
@@ -632,6 +632,77 @@ TEST(Vec, Collect) {
   // EXPECT_EQ(vc2.len(), 3_usize);
 }
 
+// Counts the number of live objects, to check they are all destroyed.
+i32 live_count;
+template <int Tag>
+struct Live {
+  explicit Live(i32 i) : i(i) { live_count += 1; }
+  Live(Live&& o) : i(o.i) { live_count += 1; }
+  Live& operator=(Live&& o) = default;
+  ~Live() { live_count -= 1; }
+  i32 i;
+};
+
+TEST(Vec, CollectInPlace) {
+  // Mapping to a type of the same size and alignment reuses the allocation.
+  {
+    auto v = Vec<i32>(1, 2, 3);
+    const void* storage = v.as_ptr();
+    Vec<u32> v2 = sus::move(v)
+                      .into_iter()
+                      .map([](i32 i) { return u32::try_from(i * 2).unwrap(); })
+                      .collect_vec();
+    EXPECT_EQ(v2, Vec<u32>(2u, 4u, 6u));
+    EXPECT_EQ(v2.capacity(), 3u);
+    EXPECT_EQ(static_cast<const void*>(v2.as_ptr()), storage);
+  }
+  // After some items were consumed from each end.
+  {
+    auto v = Vec<i32>::with_capacity(8u);
+    v.extend(sus::Array<i32, 5>(1, 2, 3, 4, 5));
+    const void* storage = v.as_ptr();
+    auto it = sus::move(v).into_iter().map(
+        [](i32 i) { return u32::try_from(i).unwrap(); });
+    EXPECT_EQ(it.next(), sus::some(1u));
+    EXPECT_EQ(it.next_back(), sus::some(5u));
+    Vec<u32> v2 = sus::move(it).collect<Vec<u32>>();
+    EXPECT_EQ(v2, Vec<u32>(2u, 3u, 4u));
+    EXPECT_EQ(v2.capacity(), 8u);
+    EXPECT_EQ(static_cast<const void*>(v2.as_ptr()), storage);
+  }
+  // Different sizes need a new allocation.
+  {
+    auto v = Vec<i32>(1, 2, 3);
+    Vec<i64> v2 = sus::move(v)
+                      .into_iter()
+                      .map([](i32 i) { return i64::from(i); })
+                      .collect_vec();
+    EXPECT_EQ(v2, Vec<i64>(1_i64, 2_i64, 3_i64));
+  }
+  // All objects are destroyed.
+  {
+    auto v = Vec<Live<0>>();
+    for (i32 i : sus::Array<i32, 4>(1, 2, 3, 4)) v.push(Live<0>(i));
+    const void* storage = v.as_ptr();
+    auto it = sus::move(v).into_iter().map(
+        [](Live<0>&& l) { return Live<1>(l.i * 10); });
+    EXPECT_EQ(it.next().unwrap().i, 10);
+    Vec<Live<1>> v2 = sus::move(it).collect_vec();
+    EXPECT_EQ(static_cast<const void*>(v2.as_ptr()), storage);
+    EXPECT_EQ(v2.len(), 3u);
+    EXPECT_EQ(v2[0u].i, 20);
+    EXPECT_EQ(v2[2u].i, 40);
+    EXPECT_EQ(live_count, 3);
+  }
+  EXPECT_EQ(live_count, 0);
+
+  // Constant expressions make a new allocation.
+  static_assert(Vec<i32>(1, 2, 3)
+                    .into_iter()
+                    .map([](i32 i) { return u32::try_from(i).unwrap(); })
+                    .collect_vec() == Vec<u32>(1u, 2u, 3u));
+}
+
 TEST(Vec, SizeHint) {
   auto v = Vec<i32>();
   v.push(1_i32);
@@ -0,0 +1,52 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/mem/move.h"
+
+namespace sus::iter::__private {
+
+/// Reports if `T` is a const reference to an iterable that can be iterated
+/// without being consumed, such as the `const Vec<T>&` items of a slice
+/// iterator.
+template <class T>
+concept BorrowedIterable =
+    std::is_lvalue_reference_v<T> &&
+    std::is_const_v<std::remove_reference_t<T>> && requires(T t) {
+      typename std::decay_t<decltype(t.iter())>::Item;
+    };
+
+/// Produces the iterator over an iterable that is being flattened.
+///
+/// Iterables held by const reference are iterated through `iter()`, which
+/// walks their storage in place. Others are consumed by `into_iter()`.
+template <class T>
+constexpr auto flatten_each_iter(T&& each) noexcept {
+  if constexpr (BorrowedIterable<T>)
+    return each.iter();
+  else
+    return ::sus::move(each).into_iter();
+}
+
+/// The type of iterator produced by `flatten_each_iter()` for `T`.
+template <class T>
+using FlattenEachIter =
+    std::decay_t<decltype(flatten_each_iter(std::declval<T>()))>;
+
+}  // namespace sus::iter::__private
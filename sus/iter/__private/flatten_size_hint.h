@@ -0,0 +1,78 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+
+#include <type_traits>
+
+#include "sus/iter/size_hint.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/mem/move.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::iter::__private {
+
+/// Reports if every value of the iterable type `T` produces the same number of
+/// items, which is known from the type alone.
+template <class T>
+struct ConstSizeIterable {
+  static constexpr bool value = false;
+};
+
+template <class T, size_t N>
+struct ConstSizeIterable<::sus::collections::Array<T, N>> {
+  static constexpr bool value = true;
+  static constexpr size_t size = N;
+};
+
+/// Computes the `SizeHint` of an iterator that flattens the iterables produced
+/// by `outer`, where `front` and `back` are the hints of the partially consumed
+/// iterators at each end.
+///
+/// The items left in `front` and `back` are always included. Items from the
+/// iterables not yet produced by `outer` are only counted when each iterable
+/// has a size known from its type. Otherwise there is no upper bound unless
+/// `outer` is known to be empty.
+template <class Iterable>
+constexpr SizeHint flatten_size_hint(SizeHint front, SizeHint back,
+                                     SizeHint outer) noexcept {
+  using Each = ConstSizeIterable<std::remove_cvref_t<Iterable>>;
+
+  ::sus::num::usize lo = front.lower.saturating_add(back.lower);
+  ::sus::Option<::sus::num::usize> hi;
+  if (front.upper.is_some() && back.upper.is_some())
+    hi = (*front.upper).checked_add(*back.upper);
+
+  if constexpr (Each::value) {
+    const auto n = ::sus::num::usize(Each::size);
+    lo = lo.saturating_add(outer.lower.saturating_mul(n));
+    if (hi.is_some() && outer.upper.is_some()) {
+      hi = (*outer.upper).checked_mul(n).and_then(
+          [h = *hi](::sus::num::usize more) { return h.checked_add(more); });
+    } else {
+      hi = ::sus::Option<::sus::num::usize>();
+    }
+  } else {
+    if (outer.upper.is_none() || *outer.upper != 0u)
+      hi = ::sus::Option<::sus::num::usize>();
+  }
+  return SizeHint(lo, ::sus::move(hi));
+}
+
+}  // namespace sus::iter::__private
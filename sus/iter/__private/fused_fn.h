@@ -0,0 +1,169 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/option/option.h"
+
+// The closures of adjacent `map()` and `filter()` adaptors are fused into a
+// single closure, so that a chain such as `map(f).filter(g).map(h)` is a single
+// adaptor over the original iterator instead of a nested adaptor for each call.
+// Each closure below is called with the items of the original iterator.
+
+namespace sus::iter::__private {
+
+/// Reports the adaptor types whose closure can be fused with a following
+/// `map()` or `filter()`.
+template <class T>
+struct IsMap {
+  static constexpr bool value = false;
+};
+template <class ToItem, class InnerSizedIter, class MapFn>
+struct IsMap<Map<ToItem, InnerSizedIter, MapFn>> {
+  static constexpr bool value = true;
+};
+
+template <class T>
+struct IsFilter {
+  static constexpr bool value = false;
+};
+template <class InnerSizedIter, class Pred>
+struct IsFilter<Filter<InnerSizedIter, Pred>> {
+  static constexpr bool value = true;
+};
+
+template <class T>
+struct IsFilterMap {
+  static constexpr bool value = false;
+};
+template <class ToItem, class InnerSizedIter, class FilterMapFn>
+struct IsFilterMap<FilterMap<ToItem, InnerSizedIter, FilterMapFn>> {
+  static constexpr bool value = true;
+};
+
+/// `map(f).map(g)`: Maps each item through `f` and then `g`.
+template <class F, class G>
+struct FusedMapMap {
+  F f;
+  G g;
+
+  template <class T>
+  constexpr decltype(auto) operator()(T&& t) noexcept {
+    return ::sus::fn::call_mut(g,
+                               ::sus::fn::call_mut(f, ::sus::forward<T>(t)));
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(f), decltype(g));
+};
+
+/// `filter(f).filter(g)`: Keeps the items for which both `f` and `g` return
+/// true.
+template <class F, class G>
+struct FusedFilterFilter {
+  F f;
+  G g;
+
+  template <class T>
+  constexpr bool operator()(const T& t) noexcept {
+    return ::sus::fn::call_mut(f, t) && ::sus::fn::call_mut(g, t);
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(f), decltype(g));
+};
+
+/// `map(f).filter(g)`: Maps each item through `f`, and keeps the results for
+/// which `g` returns true.
+template <class R, class F, class G>
+struct FusedMapFilter {
+  F f;
+  G g;
+
+  template <class T>
+  constexpr Option<R> operator()(T&& t) noexcept {
+    auto o = Option<R>(::sus::fn::call_mut(f, ::sus::forward<T>(t)));
+    if (!::sus::fn::call_mut(g, o.as_value())) return Option<R>();
+    return o;
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(f), decltype(g));
+};
+
+/// `filter(f).map(g)`: Maps the items for which `f` returns true through `g`.
+template <class R, class F, class G>
+struct FusedFilterMap {
+  F f;
+  G g;
+
+  template <class T>
+  constexpr Option<R> operator()(T&& t) noexcept {
+    if (!::sus::fn::call_mut(f, std::as_const(t))) return Option<R>();
+    return Option<R>(::sus::fn::call_mut(g, ::sus::forward<T>(t)));
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(f), decltype(g));
+};
+
+/// `filter_map(f).map(g)`: Maps the items which `f` returns through `g`.
+template <class R, class F, class G>
+struct FusedFilterMapMap {
+  F f;
+  G g;
+
+  template <class T>
+  constexpr Option<R> operator()(T&& t) noexcept {
+    auto o = ::sus::fn::call_mut(f, ::sus::forward<T>(t));
+    if (o.is_none()) return Option<R>();
+    return Option<R>(::sus::fn::call_mut(
+        g, ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn)));
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(f), decltype(g));
+};
+
+/// `filter_map(f).filter(g)`: Keeps the items which `f` returns and for which
+/// `g` returns true.
+template <class F, class G>
+struct FusedFilterMapFilter {
+  F f;
+  G g;
+
+  template <class T>
+  constexpr auto operator()(T&& t) noexcept {
+    auto o = ::sus::fn::call_mut(f, ::sus::forward<T>(t));
+    if (o.is_some() && !::sus::fn::call_mut(g, o.as_value()))
+      return decltype(o)();
+    return o;
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(f), decltype(g));
+};
+
+}  // namespace sus::iter::__private
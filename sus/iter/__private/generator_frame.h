@@ -0,0 +1,229 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace sus::iter::__private {
+
+/// The unit in which coroutine frames are allocated, which provides the
+/// alignment that `operator new` would.
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameBlock {
+  char bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+};
+
+/// Frees a coroutine frame, given the frame size requested by the compiler.
+using FrameDeallocFn = void (*)(void* frame, size_t size) noexcept;
+
+/// Each coroutine frame is followed by a trailer which records how to free it.
+/// It starts at the first `FrameBlock` boundary after the frame.
+constexpr size_t frame_trailer_offset(size_t size) noexcept {
+  return (size + sizeof(FrameBlock) - 1u) / sizeof(FrameBlock) *
+         sizeof(FrameBlock);
+}
+
+inline FrameDeallocFn& frame_dealloc_fn(void* frame, size_t size) noexcept {
+  return *std::launder(reinterpret_cast<FrameDeallocFn*>(
+      static_cast<char*>(frame) + frame_trailer_offset(size)));
+}
+
+/// A per-thread pool of coroutine frames, which are kept in free lists by size
+/// class so that creating a generator does not need to go to the global heap
+/// once the thread has created and destroyed one of a similar size.
+///
+/// Frames that are too large to pool, or that are freed on a thread whose pool
+/// is full or has been released, go to the global heap.
+class FramePool {
+ public:
+  /// Frames are pooled in size classes of this many bytes.
+  static constexpr size_t kGranularity = 64u;
+  /// The number of size classes, and thus the largest frame size pooled.
+  static constexpr size_t kNumClasses = 16u;
+  /// The number of free frames kept in each size class.
+  static constexpr uint8_t kMaxFreePerClass = 8u;
+
+  static void* allocate(size_t bytes) noexcept {
+    Lists& lists = thread_lists;
+    const size_t c = size_class(bytes);
+    if (c < kNumClasses) {
+      if (FreeFrame* f = lists.heads[c]; f != nullptr) {
+        lists.heads[c] = f->next;
+        lists.counts[c] -= 1u;
+        return f;
+      }
+      return ::operator new((c + 1u) * kGranularity);
+    }
+    return ::operator new(bytes);
+  }
+
+  static void deallocate(void* p, size_t bytes) noexcept {
+    Lists& lists = thread_lists;
+    const size_t c = size_class(bytes);
+    if (c < kNumClasses && !lists.released &&
+        lists.counts[c] < kMaxFreePerClass) {
+      if (!lists.registered) [[unlikely]] register_release();
+      lists.heads[c] = ::new (p) FreeFrame(lists.heads[c]);
+      lists.counts[c] += 1u;
+      return;
+    }
+    ::operator delete(p);
+  }
+
+ private:
+  struct FreeFrame {
+    FreeFrame* next;
+  };
+
+  // This is trivially destructible so it can be used from thread-local
+  // destructors that run after the `Releaser`, which marks it `released`.
+  struct Lists {
+    FreeFrame* heads[kNumClasses];
+    uint8_t counts[kNumClasses];
+    bool registered;
+    bool released;
+  };
+  static_assert(std::is_trivially_destructible_v<Lists>);
+
+  // Frees the pooled frames when the thread exits.
+  struct Releaser {
+    ~Releaser() noexcept {
+      Lists& lists = thread_lists;
+      lists.released = true;
+      for (FreeFrame*& head : lists.heads) {
+        while (head != nullptr) {
+          FreeFrame* f = head;
+          head = f->next;
+          ::operator delete(f);
+        }
+      }
+    }
+  };
+
+  static size_t size_class(size_t bytes) noexcept {
+    return (bytes - 1u) / kGranularity;
+  }
+
+  static void register_release() noexcept {
+    static thread_local Releaser releaser;
+    thread_lists.registered = true;
+  }
+
+  static inline constinit thread_local Lists thread_lists = {};
+};
+
+/// Allocates a coroutine frame of `size` bytes from the thread's `FramePool`.
+inline void* allocate_pooled_frame(size_t size) noexcept {
+  const size_t bytes = frame_trailer_offset(size) + sizeof(FrameDeallocFn);
+  void* frame = FramePool::allocate(bytes);
+  ::new (static_cast<char*>(frame) + frame_trailer_offset(size))
+      FrameDeallocFn([](void* frame, size_t size) noexcept {
+        FramePool::deallocate(
+            frame, frame_trailer_offset(size) + sizeof(FrameDeallocFn));
+      });
+  return frame;
+}
+
+/// The allocator type used to allocate a frame with an allocator `Alloc`.
+template <class Alloc>
+using FrameAllocator =
+    typename std::allocator_traits<Alloc>::template rebind_alloc<FrameBlock>;
+
+/// Allocators that can be given to a coroutine to allocate its frame.
+template <class Alloc>
+concept FrameAllocatorType =
+    requires { typename Alloc::value_type; } &&
+    std::is_nothrow_move_constructible_v<FrameAllocator<Alloc>> &&
+    alignof(FrameAllocator<Alloc>) <= alignof(FrameBlock) &&
+    requires(FrameAllocator<Alloc>& a, size_t n) {
+      {
+        std::allocator_traits<FrameAllocator<Alloc>>::allocate(a, n)
+      } -> std::same_as<FrameBlock*>;
+    };
+
+/// A frame allocated with an allocator holds the allocator in its trailer,
+/// in the `FrameBlock` after the `FrameDeallocFn`.
+constexpr size_t frame_allocator_offset(size_t size) noexcept {
+  return frame_trailer_offset(size) + sizeof(FrameBlock);
+}
+
+template <class A>
+constexpr size_t frame_allocator_blocks(size_t size) noexcept {
+  return (frame_allocator_offset(size) + sizeof(A) + sizeof(FrameBlock) - 1u) /
+         sizeof(FrameBlock);
+}
+
+/// Allocates a coroutine frame of `size` bytes with a copy of `alloc`, which
+/// is kept in the frame's trailer in order to free it.
+template <FrameAllocatorType Alloc>
+void* allocate_frame_with(size_t size, const Alloc& alloc) noexcept {
+  using A = FrameAllocator<Alloc>;
+  static_assert(sizeof(FrameDeallocFn) <= sizeof(FrameBlock));
+  auto a = A(alloc);
+  void* frame = std::allocator_traits<A>::allocate(
+      a, frame_allocator_blocks<A>(size));
+  char* const trailer = static_cast<char*>(frame) + frame_trailer_offset(size);
+  ::new (trailer) FrameDeallocFn([](void* frame, size_t size) noexcept {
+    char* const p = static_cast<char*>(frame) + frame_allocator_offset(size);
+    A* stored = std::launder(reinterpret_cast<A*>(p));
+    A a = static_cast<A&&>(*stored);
+    stored->~A();
+    std::allocator_traits<A>::deallocate(a, static_cast<FrameBlock*>(frame),
+                                         frame_allocator_blocks<A>(size));
+  });
+  ::new (static_cast<char*>(frame) + frame_allocator_offset(size))
+      A(static_cast<A&&>(a));
+  return frame;
+}
+
+/// Frees a coroutine frame allocated by `allocate_pooled_frame()` or
+/// `allocate_frame_with()`.
+inline void deallocate_frame(void* frame, size_t size) noexcept {
+  frame_dealloc_fn(frame, size)(frame, size);
+}
+
+/// A base class for coroutine promise types which allocates their frames.
+///
+/// Coroutine frames are allocated from a per-thread pool, unless an allocator
+/// is passed to the coroutine after `std::allocator_arg`.
+struct FrameAllocatingPromise {
+  static void* operator new(size_t size) {
+    return allocate_pooled_frame(size);
+  }
+  template <class Alloc, class... Args>
+    requires(FrameAllocatorType<Alloc>)
+  static void* operator new(size_t size, std::allocator_arg_t,
+                            const Alloc& alloc, const Args&...) {
+    return allocate_frame_with(size, alloc);
+  }
+  // For member functions and lambdas, the object comes first.
+  template <class This, class Alloc, class... Args>
+    requires(FrameAllocatorType<Alloc>)
+  static void* operator new(size_t size, const This&, std::allocator_arg_t,
+                            const Alloc& alloc, const Args&...) {
+    return allocate_frame_with(size, alloc);
+  }
+  static void operator delete(void* frame, size_t size) noexcept {
+    deallocate_frame(frame, size);
+  }
+};
+
+}  // namespace sus::iter::__private
@@ -0,0 +1,114 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/iter/size_hint.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::iter::__private {
+
+/// Two sorted iterators that are walked together by a merging adaptor, such as
+/// `MergeBy` or `SortedUnion`.
+///
+/// Each step pulls the next element from both iterators, and the element that
+/// is not consumed by the step is put back in `a_peeked` or `b_peeked` to be
+/// pulled again by the next step.
+template <class AIter, class BIter>
+struct PeekedPair {
+  using AItem = AIter::Item;
+  using BItem = BIter::Item;
+
+  explicit constexpr PeekedPair(
+      AIter&& a, BIter&& b,
+      ::sus::Option<AItem> a_peeked = ::sus::Option<AItem>(),
+      ::sus::Option<BItem> b_peeked = ::sus::Option<BItem>()) noexcept
+      : a(::sus::move(a)),
+        b(::sus::move(b)),
+        a_peeked(::sus::move(a_peeked)),
+        b_peeked(::sus::move(b_peeked)) {}
+
+  // Type is Move and (can be) Clone.
+  PeekedPair(PeekedPair&&) = default;
+  PeekedPair& operator=(PeekedPair&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr PeekedPair clone() const noexcept
+    requires(::sus::mem::Clone<AIter> &&       //
+             ::sus::mem::Clone<BIter> &&       //
+             ::sus::mem::CloneOrRef<AItem> &&  //
+             ::sus::mem::CloneOrRef<BItem>)
+  {
+    return PeekedPair(::sus::clone(a), ::sus::clone(b), ::sus::clone(a_peeked),
+                      ::sus::clone(b_peeked));
+  }
+
+  /// Pulls the next element of `a`, which is the peeked one if there is one.
+  constexpr ::sus::Option<AItem> next_a() noexcept {
+    return a_peeked.take().or_else([this] { return a.next(); });
+  }
+  /// Pulls the next element of `b`, which is the peeked one if there is one.
+  constexpr ::sus::Option<BItem> next_b() noexcept {
+    return b_peeked.take().or_else([this] { return b.next(); });
+  }
+
+  /// The `SizeHint` of the elements left in `a`, including the peeked one.
+  constexpr SizeHint a_size_hint() const noexcept {
+    return with_peeked(a.size_hint(), a_peeked.is_some());
+  }
+  /// The `SizeHint` of the elements left in `b`, including the peeked one.
+  constexpr SizeHint b_size_hint() const noexcept {
+    return with_peeked(b.size_hint(), b_peeked.is_some());
+  }
+
+  AIter a;
+  BIter b;
+  // At most one of these holds an element at a time, which was pulled from
+  // its iterator but was not yet returned.
+  ::sus::Option<AItem> a_peeked;
+  ::sus::Option<BItem> b_peeked;
+
+ private:
+  static constexpr SizeHint with_peeked(SizeHint hint, bool peeked) noexcept {
+    if (!peeked) return hint;
+    return SizeHint(hint.lower.saturating_add(1u),
+                    ::sus::move(hint.upper).and_then([](::sus::num::usize u) {
+                      return u.checked_add(1u);
+                    }));
+  }
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(a), decltype(b),
+                                           decltype(a_peeked),
+                                           decltype(b_peeked));
+};
+
+/// Adds together the size hints of two iterators. There is no upper bound if
+/// either has none, or if the sum overflows.
+constexpr SizeHint add_size_hints(SizeHint a, SizeHint b) noexcept {
+  auto lower = a.lower.saturating_add(b.lower);
+  auto upper = ::sus::Option<::sus::num::usize>();
+  if (a.upper.is_some() && b.upper.is_some())
+    upper = (*a.upper).checked_add(*b.upper);
+  return SizeHint(lower, upper);
+}
+
+}  // namespace sus::iter::__private
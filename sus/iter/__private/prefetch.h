@@ -0,0 +1,45 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/macros/compiler.h"
+
+#if SUS_COMPILER_IS_MSVC
+#  include <intrin.h>
+#endif
+
+namespace sus::iter::__private {
+
+/// Hints to the CPU that the memory at `ptr` will be read soon, so that it can
+/// be brought into the cache. It is a no-op in constant evaluation, and does
+/// not dereference `ptr`, so `ptr` may be invalid.
+constexpr inline void prefetch(const void* ptr) noexcept {
+  if (std::is_constant_evaluated()) return;
+#if SUS_COMPILER_IS_MSVC
+#  if defined(_M_X64) || defined(_M_IX86)
+  _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#  elif defined(_M_ARM64)
+  __prefetch(ptr);
+#  endif
+#else
+  __builtin_prefetch(ptr);
+#endif
+}
+
+}  // namespace sus::iter::__private
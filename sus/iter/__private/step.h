@@ -16,6 +16,8 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
 #include "sus/marker/unsafe.h"
 #include "sus/num/integer_concepts.h"
 #include "sus/num/unsigned_integer.h"
@@ -40,8 +42,34 @@ constexpr T step_backward(T l) noexcept {
 template <::sus::num::IntegerNumeric T>
 constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
                                                          const T& r) noexcept {
-  return r.checked_sub(l).and_then(
-      [](T steps) { return ::sus::num::usize::try_from(steps).ok(); });
+  if (r < l) return sus::none();
+  using U = std::make_unsigned_t<decltype(l.primitive_value)>;
+  // The difference between two signed values can be larger than the signed
+  // `MAX`, but it always fits in the unsigned type of the same size.
+  return ::sus::num::usize::try_from(static_cast<U>(
+                                         static_cast<U>(r.primitive_value) -
+                                         static_cast<U>(l.primitive_value)))
+      .ok();
+}
+template <::sus::num::IntegerNumeric T>
+constexpr T step_forward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                      ::sus::num::usize n) noexcept {
+  using P = decltype(l.primitive_value);
+  using U = std::make_unsigned_t<P>;
+  // SAFETY: The caller ensures `l + n` is in range, so adding in the unsigned
+  // type of the same size and casting back produces the right value.
+  return T(static_cast<P>(static_cast<U>(static_cast<U>(l.primitive_value) +
+                                         static_cast<U>(n.primitive_value))));
+}
+template <::sus::num::IntegerNumeric T>
+constexpr T step_backward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                       ::sus::num::usize n) noexcept {
+  using P = decltype(l.primitive_value);
+  using U = std::make_unsigned_t<P>;
+  // SAFETY: The caller ensures `l - n` is in range, so subtracting in the
+  // unsigned type of the same size and casting back produces the right value.
+  return T(static_cast<P>(static_cast<U>(static_cast<U>(l.primitive_value) -
+                                         static_cast<U>(n.primitive_value))));
 }
 
 template <::sus::num::IntegerPointer T>
@@ -64,6 +92,16 @@ constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
   return r.checked_sub(l).and_then(
       [](T steps) { return ::sus::num::usize::try_from(steps).ok(); });
 }
+template <::sus::num::IntegerPointer T>
+constexpr T step_forward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                      ::sus::num::usize n) noexcept {
+  return l.unchecked_add(::sus::marker::unsafe_fn, n);
+}
+template <::sus::num::IntegerPointer T>
+constexpr T step_backward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                       ::sus::num::usize n) noexcept {
+  return l.unchecked_sub(::sus::marker::unsafe_fn, n);
+}
 
 template <::sus::num::PrimitiveInteger T>
 constexpr T step_max() noexcept {
@@ -86,11 +124,32 @@ template <::sus::num::PrimitiveInteger T>
 constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
                                                          const T& r) noexcept {
   if (r >= l) {
-    return ::sus::num::usize::try_from(r - l).ok();
+    using U = std::make_unsigned_t<T>;
+    return ::sus::num::usize::try_from(
+               static_cast<U>(static_cast<U>(r) - static_cast<U>(l)))
+        .ok();
   } else {
     return sus::none();
   }
 }
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_forward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                      ::sus::num::usize n) noexcept {
+  using U = std::make_unsigned_t<T>;
+  // SAFETY: The caller ensures `l + n` is in range, so adding in the unsigned
+  // type of the same size and casting back produces the right value.
+  return static_cast<T>(static_cast<U>(static_cast<U>(l) +
+                                       static_cast<U>(n.primitive_value)));
+}
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_backward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                       ::sus::num::usize n) noexcept {
+  using U = std::make_unsigned_t<T>;
+  // SAFETY: The caller ensures `l - n` is in range, so subtracting in the
+  // unsigned type of the same size and casting back produces the right value.
+  return static_cast<T>(static_cast<U>(static_cast<U>(l) -
+                                       static_cast<U>(n.primitive_value)));
+}
 
 /// Objects that have a notion of successor and predecessor operations.
 ///
@@ -102,6 +161,14 @@ concept Step = requires(const T& t, ::sus::num::usize n) {
   { ::sus::iter::__private::step_max<T>() } noexcept -> std::same_as<T>;
   { ::sus::iter::__private::step_forward(t) } noexcept -> std::same_as<T>;
   { ::sus::iter::__private::step_backward(t) } noexcept -> std::same_as<T>;
+  {
+    ::sus::iter::__private::step_forward_by_unchecked(::sus::marker::unsafe_fn,
+                                                      t, n)
+  } noexcept -> std::same_as<T>;
+  {
+    ::sus::iter::__private::step_backward_by_unchecked(::sus::marker::unsafe_fn,
+                                                       t, n)
+  } noexcept -> std::same_as<T>;
   /* These are part of Rust std, but are not used in C++ yet, so not required.
   {
     ::sus::iter::__private::step_forward_checked(t)
@@ -0,0 +1,127 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+
+#include "sus/collections/array.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator over `N` elements of another iterator at a time.
+///
+/// This type is returned from `Iterator::array_chunks()`.
+template <class InnerSizedIter, size_t N>
+class [[nodiscard]] ArrayChunks final
+    : public IteratorBase<
+          ArrayChunks<InnerSizedIter, N>,
+          ::sus::collections::Array<typename InnerSizedIter::Item, N>> {
+  using FromItem = InnerSizedIter::Item;
+
+ public:
+  using Item = ::sus::collections::Array<FromItem, N>;
+
+  // Type is Move and (can be) Clone.
+  ArrayChunks(ArrayChunks&&) = default;
+  ArrayChunks& operator=(ArrayChunks&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr ArrayChunks clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<FromItem>)
+  {
+    return ArrayChunks(CLONE, ::sus::clone(next_iter_),
+                       ::sus::clone(remainder_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    auto chunk = next_iter_.template next_chunk<N>();
+    if (chunk.is_ok()) {
+      return Option<Item>(
+          ::sus::move(chunk).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
+    auto partial =
+        ::sus::move(chunk).unwrap_err_unchecked(::sus::marker::unsafe_fn);
+    // Keep the elements left over from the last chunk if `next()` is called
+    // again after the inner iterator is exhausted.
+    if (partial.get_unchecked(::sus::marker::unsafe_fn, 0u).is_some())
+      remainder_ = ::sus::move(partial);
+    return Option<Item>();
+  }
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto [lower, upper] = next_iter_.size_hint();
+    return {lower / N, upper.map([](usize u) { return u / N; })};
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  constexpr usize exact_size_hint() const noexcept
+    requires(ExactSizeIterator<InnerSizedIter, FromItem>)
+  {
+    return next_iter_.exact_size_hint() / N;
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter>)
+  {
+    return {};
+  }
+
+  /// Returns an iterator over the elements which were left over after the
+  /// iterator was exhausted, as there were fewer than `N` of them.
+  ///
+  /// If the iterator has not yet returned `None` from `next()` the returned
+  /// iterator will be empty.
+  constexpr Iterator<FromItem> auto into_remainder() && noexcept {
+    return ::sus::move(remainder_).into_iter().flatten();
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  explicit constexpr ArrayChunks(InnerSizedIter&& next_iter) noexcept
+      : next_iter_(::sus::move(next_iter)) {}
+
+  enum Clone { CLONE };
+  explicit constexpr ArrayChunks(
+      Clone, InnerSizedIter&& next_iter,
+      ::sus::collections::Array<Option<FromItem>, N>&& remainder) noexcept
+      : next_iter_(::sus::move(next_iter)),
+        remainder_(::sus::move(remainder)) {}
+
+  InnerSizedIter next_iter_;
+  // Holds elements pulled from `next_iter_` for the next chunk, and the
+  // elements left over once `next_iter_` is exhausted.
+  ::sus::collections::Array<Option<FromItem>, N> remainder_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(next_iter_),
+                                           decltype(remainder_));
+};
+
+}  // namespace sus::iter
@@ -0,0 +1,115 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/assertions/check.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator over batches of elements of another iterator, which are
+/// collected into a reusable buffer.
+///
+/// This type is returned from `Iterator::batched()`.
+template <class InnerSizedIter>
+class [[nodiscard]] Batched final
+    : public IteratorBase<
+          Batched<InnerSizedIter>,
+          ::sus::collections::SliceMut<typename InnerSizedIter::Item>> {
+  using FromItem = InnerSizedIter::Item;
+
+ public:
+  using Item = ::sus::collections::SliceMut<FromItem>;
+
+  // Type is Move and (can be) Clone.
+  Batched(Batched&&) = default;
+  Batched& operator=(Batched&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr Batched clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter>)
+  {
+    // The buffer only holds the batch that was last returned, which is not
+    // part of the iteration that remains.
+    return Batched(batch_size_, ::sus::clone(next_iter_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    buffer_.clear();
+    while (buffer_.len() < batch_size_) {
+      Option<FromItem> o = next_iter_.next();
+      if (o.is_none()) break;
+      buffer_.push(::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
+    if (buffer_.is_empty()) return Option<Item>();
+    return Option<Item>(buffer_.as_mut_slice());
+  }
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto batches = [this](usize n) {
+      return n / batch_size_ + (n % batch_size_ != 0u ? 1u : 0u);
+    };
+    auto [lower, upper] = next_iter_.size_hint();
+    return {batches(lower), upper.map(batches)};
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  constexpr usize exact_size_hint() const noexcept
+    requires(ExactSizeIterator<InnerSizedIter, FromItem>)
+  {
+    return size_hint().lower;
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter>)
+  {
+    return {};
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  explicit constexpr Batched(usize batch_size,
+                             InnerSizedIter&& next_iter) noexcept
+      : batch_size_(batch_size),
+        next_iter_(::sus::move(next_iter)),
+        buffer_(::sus::collections::Vec<FromItem>::with_capacity(batch_size)) {
+    sus_check(batch_size_ > 0u);
+  }
+
+  usize batch_size_;
+  InnerSizedIter next_iter_;
+  ::sus::collections::Vec<FromItem> buffer_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(batch_size_),
+                                           decltype(next_iter_),
+                                           decltype(buffer_));
+};
+
+}  // namespace sus::iter
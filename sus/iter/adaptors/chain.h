@@ -16,10 +16,15 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
@@ -91,6 +96,69 @@ class [[nodiscard]] Chain final
         });
   }
 
+  // sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto chain_fold = [&f](B acc, Item&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc),
+                                 ::sus::forward<Item>(item));
+    };
+    B acc = first_iter_.is_some()
+                ? ::sus::move(first_iter_)
+                      .unwrap_unchecked(::sus::marker::unsafe_fn)
+                      .template fold<B>(::sus::forward<B>(init), chain_fold)
+                : ::sus::forward<B>(init);
+    if (second_iter_.is_some()) {
+      return ::sus::move(second_iter_)
+          .unwrap_unchecked(::sus::marker::unsafe_fn)
+          .template fold<B>(::sus::forward<B>(acc), chain_fold);
+    }
+    return acc;
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, Item> &&
+             DoubleEndedIterator<OtherSizedIter, Item>)
+  constexpr B rfold(B init, F f) && noexcept {
+    auto chain_fold = [&f](B acc, Item&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc),
+                                 ::sus::forward<Item>(item));
+    };
+    B acc = second_iter_.is_some()
+                ? ::sus::move(second_iter_)
+                      .unwrap_unchecked(::sus::marker::unsafe_fn)
+                      .template rfold<B>(::sus::forward<B>(init), chain_fold)
+                : ::sus::forward<B>(init);
+    if (first_iter_.is_some()) {
+      return ::sus::move(first_iter_)
+          .unwrap_unchecked(::sus::marker::unsafe_fn)
+          .template rfold<B>(::sus::forward<B>(acc), chain_fold);
+    }
+    return acc;
+  }
+
+  // sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto chain_fold = [&f](B acc, Item&& item) -> R {
+      return ::sus::fn::call_mut(f, ::sus::move(acc),
+                                 ::sus::forward<Item>(item));
+    };
+    if (first_iter_.is_some()) {
+      R out = first_iter_->try_fold(::sus::move(init), chain_fold);
+      if (!::sus::ops::try_is_success(out)) return out;
+      init = ::sus::ops::try_into_output(::sus::move(out));
+      first_iter_ = Option<InnerSizedIter>();
+    }
+    if (second_iter_.is_some())
+      return second_iter_->try_fold(::sus::move(init), chain_fold);
+    return ::sus::ops::try_from_output<R>(::sus::move(init));
+  }
+
   constexpr SizeHint size_hint() const noexcept {
     if (first_iter_.is_none()) {
       if (second_iter_.is_none()) {
@@ -0,0 +1,186 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator over a group of consecutive elements with the same key, which
+/// are pulled from the `ChunkBy` iterator that produced it.
+///
+/// The group is only valid until the `ChunkBy` iterator is moved or destroyed.
+/// Once the `ChunkBy` iterator moves on to the next group, this iterator
+/// returns `None`, and its `key()` must not be used.
+///
+/// This type is returned from `ChunkBy::next()`.
+template <class InnerSizedIter, class KeyFn>
+class [[nodiscard]] ChunkByGroup final
+    : public IteratorBase<ChunkByGroup<InnerSizedIter, KeyFn>,
+                          typename InnerSizedIter::Item> {
+  using Parent = ChunkBy<InnerSizedIter, KeyFn>;
+
+ public:
+  using Item = InnerSizedIter::Item;
+  using Key =
+      std::invoke_result_t<KeyFn&, const std::remove_reference_t<Item>&>;
+
+  // Type is Move.
+  ChunkByGroup(ChunkByGroup&&) = default;
+  ChunkByGroup& operator=(ChunkByGroup&&) = default;
+
+  /// The key shared by every element in the group.
+  constexpr const Key& key() const& noexcept {
+    return parent_->current_key_.as_value();
+  }
+  constexpr const Key& key() && = delete;
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (parent_->generation_ != generation_) return Option<Item>();
+    return parent_->next_in_group();
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    if (parent_->generation_ != generation_ || parent_->pending_.is_none())
+      return SizeHint(0u, ::sus::Option<usize>(0u));
+    // There may be one element pending, which may or may not be in this group.
+    return SizeHint(0u, parent_->next_iter_.size_hint().upper.and_then(
+                            [](usize u) { return u.checked_add(1u); }));
+  }
+
+ private:
+  friend Parent;
+
+  explicit constexpr ChunkByGroup(Parent& parent, usize generation) noexcept
+      : parent_(&parent), generation_(generation) {}
+
+  Parent* parent_;
+  usize generation_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(parent_), decltype(generation_));
+};
+
+/// An iterator over groups of consecutive elements with the same key.
+///
+/// This type is returned from `Iterator::chunk_by()`.
+template <class InnerSizedIter, class KeyFn>
+class [[nodiscard]] ChunkBy final
+    : public IteratorBase<ChunkBy<InnerSizedIter, KeyFn>,
+                          ChunkByGroup<InnerSizedIter, KeyFn>> {
+  using FromItem = InnerSizedIter::Item;
+
+ public:
+  using Item = ChunkByGroup<InnerSizedIter, KeyFn>;
+  using Key =
+      std::invoke_result_t<KeyFn&, const std::remove_reference_t<FromItem>&>;
+
+  static_assert(!std::is_reference_v<Key>);
+
+  // Type is Move.
+  ChunkBy(ChunkBy&&) = default;
+  ChunkBy& operator=(ChunkBy&&) = default;
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (current_key_.is_some()) {
+      // Skip the rest of the current group.
+      while (pending_in_group()) pull();
+    } else if (pending_.is_none()) {
+      pull();
+    }
+    if (pending_.is_none()) {
+      current_key_ = Option<Key>();
+      return Option<Item>();
+    }
+    // The pending element starts the new group.
+    current_key_ = pending_key_.take();
+    generation_ += 1u;
+    return Option<Item>(Item(*this, generation_));
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    // Every element may be in its own group.
+    usize pending = pending_.is_some() ? 1u : 0u;
+    auto upper = next_iter_.size_hint().upper.and_then(
+        [pending](usize u) { return u.checked_add(pending); });
+    return SizeHint(0u, upper);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+  friend Item;
+
+  explicit constexpr ChunkBy(KeyFn&& fn, InnerSizedIter&& next_iter) noexcept
+      : fn_(::sus::move(fn)), next_iter_(::sus::move(next_iter)) {}
+
+  // Pulls the next element from the inner iterator into `pending_`.
+  constexpr void pull() noexcept {
+    pending_ = next_iter_.next();
+    if (pending_.is_some()) {
+      pending_key_ =
+          Option<Key>(::sus::fn::call_mut(fn_, pending_.as_value()));
+    } else {
+      pending_key_ = Option<Key>();
+    }
+  }
+
+  // Whether the pending element is part of the current group. The element that
+  // starts a group has its key moved to `current_key_`, leaving `pending_key_`
+  // empty.
+  constexpr bool pending_in_group() const noexcept {
+    if (pending_.is_none()) return false;
+    return pending_key_.is_none() ||
+           pending_key_.as_value() == current_key_.as_value();
+  }
+
+  constexpr Option<FromItem> next_in_group() noexcept {
+    if (!pending_in_group()) return Option<FromItem>();
+    Option<FromItem> out = pending_.take();
+    pull();
+    return out;
+  }
+
+  KeyFn fn_;
+  InnerSizedIter next_iter_;
+  // The element pulled from `next_iter_` that has not been returned yet.
+  Option<FromItem> pending_;
+  Option<Key> pending_key_;
+  // The key of the group most recently returned from `next()`.
+  Option<Key> current_key_;
+  // Counts the groups returned, so that a group can tell when it has ended.
+  usize generation_;
+
+  sus_class_trivially_relocatable_if_types(
+      ::sus::marker::unsafe_fn, decltype(fn_), decltype(next_iter_),
+      decltype(pending_), decltype(pending_key_), decltype(current_key_),
+      decltype(generation_));
+};
+
+}  // namespace sus::iter
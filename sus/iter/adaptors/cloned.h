@@ -16,10 +16,16 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
 #include "sus/mem/clone.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
@@ -30,8 +36,10 @@ template <class InnerSizedIter>
 class [[nodiscard]] Cloned final
     : public IteratorBase<Cloned<InnerSizedIter>,
                           std::remove_cvref_t<typename InnerSizedIter::Item>> {
+  using FromItem = typename InnerSizedIter::Item;
+
  public:
-  using Item = std::remove_cvref_t<typename InnerSizedIter::Item>;
+  using Item = std::remove_cvref_t<FromItem>;
 
   // Type is Move and (can be) Clone.
   Cloned(Cloned&&) = default;
@@ -57,15 +65,48 @@ class [[nodiscard]] Cloned final
 
   // sus::iter::DoubleEndedIterator trait.
   constexpr Option<Item> next_back() noexcept
-    requires(DoubleEndedIterator<InnerSizedIter, Item>)
+    requires(DoubleEndedIterator<InnerSizedIter, FromItem>)
   {
     return next_iter_.next_back().map(
         [](const Item& item) { return ::sus::clone(item); });
   }
 
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto clone_fold = [&f](B acc, FromItem&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc), ::sus::clone(item));
+    };
+    return ::sus::move(next_iter_)
+        .template fold<B>(::sus::forward<B>(init), clone_fold);
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, FromItem>)
+  constexpr B rfold(B init, F f) && noexcept {
+    auto clone_fold = [&f](B acc, FromItem&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc), ::sus::clone(item));
+    };
+    return ::sus::move(next_iter_)
+        .template rfold<B>(::sus::forward<B>(init), clone_fold);
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto clone_fold = [&f](B acc, FromItem&& item) -> R {
+      return ::sus::fn::call_mut(f, ::sus::move(acc), ::sus::clone(item));
+    };
+    return next_iter_.try_fold(::sus::move(init), clone_fold);
+  }
+
   // sus::iter::ExactSizeIterator trait.
   constexpr usize exact_size_hint() const noexcept
-    requires(ExactSizeIterator<InnerSizedIter, Item>)
+    requires(ExactSizeIterator<InnerSizedIter, FromItem>)
   {
     return next_iter_.exact_size_hint();
   }
@@ -78,6 +119,31 @@ class [[nodiscard]] Cloned final
     return {};
   }
 
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return ::sus::clone(next_iter_.get_unchecked(::sus::marker::unsafe_fn, i));
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    next_iter_.advance_unchecked(::sus::marker::unsafe_fn, n);
+  }
+
  private:
   template <class U, class V>
   friend class IteratorBase;
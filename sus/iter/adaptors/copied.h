@@ -16,10 +16,17 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/marker/unsafe.h"
 #include "sus/mem/clone.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
@@ -30,8 +37,10 @@ template <class InnerSizedIter>
 class [[nodiscard]] Copied final
     : public IteratorBase<Copied<InnerSizedIter>,
                           std::remove_cvref_t<typename InnerSizedIter::Item>> {
+  using FromItem = typename InnerSizedIter::Item;
+
  public:
-  using Item = std::remove_cvref_t<typename InnerSizedIter::Item>;
+  using Item = std::remove_cvref_t<FromItem>;
 
   // Type is Move and (can be) Clone.
   Copied(Copied&&) = default;
@@ -56,15 +65,76 @@ class [[nodiscard]] Copied final
 
   // sus::iter::DoubleEndedIterator trait.
   constexpr Option<Item> next_back() noexcept
-    requires(DoubleEndedIterator<InnerSizedIter, Item>)
+    requires(DoubleEndedIterator<InnerSizedIter, FromItem>)
   {
     return next_iter_.next_back().map(
         [](const Item& item) -> Item { return item; });
   }
 
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto copy_fold = [&f](B acc, FromItem&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc), Item(item));
+    };
+    return ::sus::move(next_iter_)
+        .template fold<B>(::sus::forward<B>(init), copy_fold);
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, FromItem>)
+  constexpr B rfold(B init, F f) && noexcept {
+    auto copy_fold = [&f](B acc, FromItem&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc), Item(item));
+    };
+    return ::sus::move(next_iter_)
+        .template rfold<B>(::sus::forward<B>(init), copy_fold);
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto copy_fold = [&f](B acc, FromItem&& item) -> R {
+      return ::sus::fn::call_mut(f, ::sus::move(acc), Item(item));
+    };
+    return next_iter_.try_fold(::sus::move(init), copy_fold);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Copies the next `N` items directly out of the contiguous memory of the
+  /// inner iterator, when it has one.
+  template <size_t N>
+  constexpr ::sus::result::Result<::sus::collections::Array<Item, N>,
+                                  ::sus::collections::Array<Option<Item>, N>>
+  next_chunk() noexcept {
+    if constexpr (__private::ContiguousIterator<InnerSizedIter, Item> &&
+                  __private::TrustedRandomAccess<InnerSizedIter>) {
+      if (next_iter_.exact_size_hint() >= N) {
+        using Chunk = ::sus::collections::Array<Item, N>;
+        using Partial = ::sus::collections::Array<Option<Item>, N>;
+        // SAFETY: The pointer is only used to read the `N` items remaining at
+        // the front of the inner iterator, before it is used again.
+        const Item* p = next_iter_.contiguous_data(::sus::marker::unsafe_fn);
+        auto chunk = Chunk::with_initializer([p]() mutable {
+          const Item& item = *p;
+          p += 1u;
+          return Item(item);
+        });
+        next_iter_.advance_unchecked(::sus::marker::unsafe_fn, N);
+        return ::sus::result::Result<Chunk, Partial>(::sus::move(chunk));
+      }
+    }
+    return IteratorBase<Copied, Item>::template next_chunk<N>();
+  }
+
   // sus::iter::ExactSizeIterator trait.
   constexpr usize exact_size_hint() const noexcept
-    requires(ExactSizeIterator<InnerSizedIter, Item>)
+    requires(ExactSizeIterator<InnerSizedIter, FromItem>)
   {
     return next_iter_.exact_size_hint();
   }
@@ -77,6 +147,40 @@ class [[nodiscard]] Copied final
     return {};
   }
 
+  /// sus::iter::ContiguousIterator trait.
+  /// #[doc.hidden]
+  constexpr const Item* contiguous_data(
+      ::sus::marker::UnsafeFnMarker) const noexcept
+    requires(__private::ContiguousIterator<InnerSizedIter, Item>)
+  {
+    return next_iter_.contiguous_data(::sus::marker::unsafe_fn);
+  }
+
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return Item(next_iter_.get_unchecked(::sus::marker::unsafe_fn, i));
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    next_iter_.advance_unchecked(::sus::marker::unsafe_fn, n);
+  }
+
  private:
   template <class U, class V>
   friend class IteratorBase;
@@ -16,15 +16,25 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
+#include "sus/iter/iterator_concept.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
 #include "sus/mem/clone.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
 
 namespace sus::iter {
 
 /// An iterator that repeats endlessly.
 ///
+/// When the iterator being repeated walks over contiguous memory, such as the
+/// iterator over a slice, it is not cloned each time it runs out. Instead the
+/// index of the next item wraps around to the front of it.
+///
 /// This type is returned from `Iterator::cycle()`.
 template <class InnerSizedIter>
 class [[nodiscard]] Cycle final
@@ -32,6 +42,15 @@ class [[nodiscard]] Cycle final
                           typename InnerSizedIter::Item> {
   static_assert(::sus::mem::Clone<InnerSizedIter>);
 
+  // Reading the items of a contiguous iterator has no side effects, so they
+  // can be read again from the same iterator on each cycle.
+  static constexpr bool WrapIndex =
+      __private::TrustedRandomAccess<InnerSizedIter> &&
+      __private::ContiguousIterator<
+          InnerSizedIter,
+          std::remove_cvref_t<typename InnerSizedIter::Item>>;
+  using Active = std::conditional_t<WrapIndex, usize, InnerSizedIter>;
+
  public:
   using Item = typename InnerSizedIter::Item;
 
@@ -46,12 +65,23 @@ class [[nodiscard]] Cycle final
 
   // sus::iter::Iterator trait.
   constexpr Option<Item> next() noexcept {
-    auto o = active_.next();
-    if (o.is_none()) {
-      active_ = ::sus::clone(original_);
-      o = active_.next();
+    if constexpr (WrapIndex) {
+      const usize len = original_.exact_size_hint();
+      if (len == 0u) [[unlikely]]
+        return Option<Item>();
+      if (active_ == len) active_ = 0u;
+      // SAFETY: The index is wrapped to 0 when it reaches `len`, so it is
+      // always less than `exact_size_hint()`.
+      const usize i = ::sus::mem::replace(active_, active_ + 1u);
+      return Option<Item>(original_.get_unchecked(::sus::marker::unsafe_fn, i));
+    } else {
+      auto o = active_.next();
+      if (o.is_none()) {
+        active_ = ::sus::clone(original_);
+        o = active_.next();
+      }
+      return o;
     }
-    return o;
   }
 
   /// sus::iter::Iterator trait.
@@ -88,10 +118,19 @@ class [[nodiscard]] Cycle final
   friend class IteratorBase;
 
   explicit constexpr Cycle(InnerSizedIter&& iter)
+    requires(!WrapIndex)
       : original_(::sus::clone(iter)), active_(::sus::move(iter)) {}
+  explicit constexpr Cycle(InnerSizedIter&& iter)
+    requires(WrapIndex)
+      : original_(::sus::move(iter)), active_(0u) {}
+  // Clone ctor.
+  explicit constexpr Cycle(InnerSizedIter&& original, Active&& active)
+      : original_(::sus::move(original)), active_(::sus::move(active)) {}
 
   InnerSizedIter original_;
-  InnerSizedIter active_;
+  // The index of the next item in `original_` when wrapping an index, or
+  // otherwise a clone of `original_` that is being iterated.
+  Active active_;
 
   sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
                                            decltype(original_),
@@ -0,0 +1,109 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator that removes consecutive repeated elements.
+///
+/// This type is returned from `Iterator::dedup()` and `Iterator::dedup_by()`.
+template <class InnerSizedIter, class SameFn>
+class [[nodiscard]] DedupBy final
+    : public IteratorBase<DedupBy<InnerSizedIter, SameFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static_assert(::sus::fn::FnMut<SameFn,
+                                 bool(const std::remove_reference_t<Item>&,
+                                      const std::remove_reference_t<Item>&)>);
+
+  // Type is Move and (can be) Clone.
+  DedupBy(DedupBy&&) = default;
+  DedupBy& operator=(DedupBy&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr DedupBy clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<SameFn> &&          //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    return DedupBy(::sus::clone(same_), ::sus::clone(next_iter_),
+                   ::sus::clone(next_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    Option<Item> out =
+        next_.take().or_else([this] { return next_iter_.next(); });
+    if (out.is_none()) return out;
+    // Skip over the repeats of `out`, and hold onto the first element that is
+    // not a repeat.
+    while (true) {
+      next_ = next_iter_.next();
+      if (next_.is_none() ||
+          !::sus::fn::call_mut(same_, out.as_value(), next_.as_value())) {
+        return out;
+      }
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto [lower, upper] = next_iter_.size_hint();
+    // Everything may be a repeat of the first element.
+    if (next_.is_some()) {
+      return SizeHint(1u, upper.and_then(
+                              [](usize u) { return u.checked_add(1u); }));
+    }
+    return SizeHint(lower > 0u ? 1u : 0u, upper);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  explicit constexpr DedupBy(SameFn&& same, InnerSizedIter&& next_iter,
+                             Option<Item> next = Option<Item>()) noexcept
+      : same_(::sus::move(same)),
+        next_iter_(::sus::move(next_iter)),
+        next_(::sus::move(next)) {}
+
+  SameFn same_;
+  InnerSizedIter next_iter_;
+  // The next element to return, which was pulled from `next_iter_` while
+  // skipping the repeats of the previous one.
+  Option<Item> next_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(same_),
+                                           decltype(next_iter_),
+                                           decltype(next_));
+};
+
+}  // namespace sus::iter
@@ -0,0 +1,117 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator that removes consecutive elements with the same key.
+///
+/// This type is returned from `Iterator::dedup_by_key()`.
+template <class InnerSizedIter, class KeyFn>
+class [[nodiscard]] DedupByKey final
+    : public IteratorBase<DedupByKey<InnerSizedIter, KeyFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+  using Key =
+      std::invoke_result_t<KeyFn&, const std::remove_reference_t<Item>&>;
+
+  static_assert(!std::is_reference_v<Key>);
+
+  // Type is Move and (can be) Clone.
+  DedupByKey(DedupByKey&&) = default;
+  DedupByKey& operator=(DedupByKey&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr DedupByKey clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<KeyFn> &&           //
+             ::sus::mem::Clone<Key> &&             //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    return DedupByKey(::sus::clone(fn_), ::sus::clone(next_iter_),
+                      ::sus::clone(next_), ::sus::clone(next_key_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    Option<Item> out = next_.take();
+    Option<Key> key = next_key_.take();
+    if (out.is_none()) {
+      out = next_iter_.next();
+      if (out.is_none()) return out;
+      key = Option<Key>(::sus::fn::call_mut(fn_, out.as_value()));
+    }
+    // Skip over the elements with the same key as `out`, and hold onto the
+    // first element with a different key, along with its key.
+    while (true) {
+      next_ = next_iter_.next();
+      if (next_.is_none()) return out;
+      next_key_ = Option<Key>(::sus::fn::call_mut(fn_, next_.as_value()));
+      if (next_key_.as_value() != key.as_value()) return out;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto [lower, upper] = next_iter_.size_hint();
+    // Everything may be a repeat of the first element.
+    if (next_.is_some()) {
+      return SizeHint(1u, upper.and_then(
+                              [](usize u) { return u.checked_add(1u); }));
+    }
+    return SizeHint(lower > 0u ? 1u : 0u, upper);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  explicit constexpr DedupByKey(KeyFn&& fn, InnerSizedIter&& next_iter,
+                                Option<Item> next = Option<Item>(),
+                                Option<Key> next_key = Option<Key>()) noexcept
+      : fn_(::sus::move(fn)),
+        next_iter_(::sus::move(next_iter)),
+        next_(::sus::move(next)),
+        next_key_(::sus::move(next_key)) {}
+
+  KeyFn fn_;
+  InnerSizedIter next_iter_;
+  // The next element to return, which was pulled from `next_iter_` while
+  // skipping the elements with the same key as the previous one. Its key is
+  // kept so that each key is computed only once.
+  Option<Item> next_;
+  Option<Key> next_key_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(fn_), decltype(next_iter_),
+                                           decltype(next_),
+                                           decltype(next_key_));
+};
+
+}  // namespace sus::iter
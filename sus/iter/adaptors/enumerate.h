@@ -16,9 +16,15 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/ops/try.h"
 #include "sus/tuple/tuple.h"
 
 namespace sus::iter {
@@ -43,7 +49,7 @@ class [[nodiscard]] Enumerate final
   constexpr Enumerate clone() const noexcept
     requires(::sus::mem::Clone<InnerSizedIter>)
   {
-    return Enunerate(CLONE, count_, sus::clone(next_iter_));
+    return Enumerate(CLONE, count_, sus::clone(next_iter_));
   }
 
   // sus::iter::Iterator trait.
@@ -82,6 +88,52 @@ class [[nodiscard]] Enumerate final
     }
   }
 
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto enumerate_fold = [count = count_, &f](B acc,
+                                               FromItem&& item) mutable -> B {
+      Item out(count, ::sus::forward<FromItem>(item));
+      count += 1u;
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc), ::sus::move(out));
+    };
+    return ::sus::move(next_iter_)
+        .template fold<B>(::sus::forward<B>(init), enumerate_fold);
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, FromItem> &&
+             ExactSizeIterator<InnerSizedIter, FromItem>)
+  constexpr B rfold(B init, F f) && noexcept {
+    // Can safely add, `ExactSizeIterator` promises that the number of elements
+    // fits into a `usize`.
+    auto enumerate_fold = [count = count_ + next_iter_.exact_size_hint(), &f](
+                              B acc, FromItem&& item) mutable -> B {
+      count -= 1u;
+      return ::sus::fn::call_mut(
+          f, ::sus::forward<B>(acc),
+          Item(count, ::sus::forward<FromItem>(item)));
+    };
+    return ::sus::move(next_iter_)
+        .template rfold<B>(::sus::forward<B>(init), enumerate_fold);
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto enumerate_fold = [&count = count_, &f](B acc,
+                                                FromItem&& item) -> R {
+      Item out(count, ::sus::forward<FromItem>(item));
+      count += 1u;
+      return ::sus::fn::call_mut(f, ::sus::move(acc), ::sus::move(out));
+    };
+    return next_iter_.try_fold(::sus::move(init), enumerate_fold);
+  }
+
   // sus::iter::ExactSizeIterator trait.
   constexpr usize exact_size_hint() const noexcept
     requires(ExactSizeIterator<InnerSizedIter, FromItem>)
@@ -97,6 +149,33 @@ class [[nodiscard]] Enumerate final
     return {};
   }
 
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return Item(count_ + i,
+                next_iter_.get_unchecked(::sus::marker::unsafe_fn, i));
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    count_ += n;
+    next_iter_.advance_unchecked(::sus::marker::unsafe_fn, n);
+  }
+
   // TODO: Implement nth(), nth_back(), etc...
 
  private:
@@ -16,10 +16,15 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
@@ -58,6 +63,48 @@ class [[nodiscard]] Filter final
         return item;
     }
   }
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto filter_fold = [&pred = pred_, &f](B acc, Item&& item) -> B {
+      if (::sus::fn::call_mut(pred, std::as_const(item)))
+        return ::sus::fn::call_mut(f, ::sus::forward<B>(acc),
+                                   ::sus::forward<Item>(item));
+      return ::sus::forward<B>(acc);
+    };
+    return ::sus::move(next_iter_)
+        .template fold<B>(::sus::forward<B>(init), filter_fold);
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, Item>)
+  constexpr B rfold(B init, F f) && noexcept {
+    auto filter_fold = [&pred = pred_, &f](B acc, Item&& item) -> B {
+      if (::sus::fn::call_mut(pred, std::as_const(item)))
+        return ::sus::fn::call_mut(f, ::sus::forward<B>(acc),
+                                   ::sus::forward<Item>(item));
+      return ::sus::forward<B>(acc);
+    };
+    return ::sus::move(next_iter_)
+        .template rfold<B>(::sus::forward<B>(init), filter_fold);
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto filter_fold = [&pred = pred_, &f](B acc, Item&& item) -> R {
+      if (::sus::fn::call_mut(pred, std::as_const(item)))
+        return ::sus::fn::call_mut(f, ::sus::move(acc),
+                                   ::sus::forward<Item>(item));
+      return ::sus::ops::try_from_output<R>(::sus::move(acc));
+    };
+    return next_iter_.try_fold(::sus::move(init), filter_fold);
+  }
+
   /// sus::iter::Iterator trait.
   constexpr SizeHint size_hint() const noexcept {
     // Can't know a lower bound, due to the predicate.
@@ -16,7 +16,10 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
 #include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/flatten_size_hint.h"
 #include "sus/iter/iterator_defn.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
@@ -92,11 +95,22 @@ class [[nodiscard]] FlatMap final
     auto [blo, bhi] = back_iter_.as_ref().map_or(
         SizeHint(0u, ::sus::some(0u)),
         [](const EachIter& i) { return i.size_hint(); });
-    // Lower bound is the items in the iterators we can see.
-    usize lo = flo.saturating_add(blo);
-    // We have no upper bound if there's any other iterators left, and we can't
-    // tell if there's any iterators left without additional tracking state.
-    return SizeHint(lo, ::sus::Option<usize>());
+    return __private::flatten_size_hint<IntoIterable>(
+        SizeHint(flo, ::sus::move(fhi)), SizeHint(blo, ::sus::move(bhi)),
+        iters_.size_hint());
+  }
+
+  /// sus::iter::TrustedLen trait.
+  ///
+  /// The length is known when each iterable has a size known from its type,
+  /// such as an [`Array`]($sus::collections::Array).
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter> &&  //
+             __private::ConstSizeIterable<
+                 std::remove_cvref_t<IntoIterable>>::value)
+  {
+    return {};
   }
 
   // sus::iter::DoubleEndedIterator trait.
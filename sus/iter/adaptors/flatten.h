@@ -16,12 +16,40 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/flatten_each.h"
+#include "sus/iter/__private/flatten_size_hint.h"
+#include "sus/iter/iterator_concept.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/macros/no_unique_address.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
+namespace __private {
+
+/// Reports if the iterables are held in contiguous memory by the iterator `T`
+/// and each can report its length, such as when iterating over a slice of
+/// `Vec`, so that the number of items in all of them can be counted without
+/// consuming the iterator.
+template <class T>
+concept FlattenCountable =
+    ContiguousIterator<T, std::remove_cvref_t<typename T::Item>> &&
+    requires(const std::remove_cvref_t<typename T::Item>& each) {
+      { each.len() } -> std::same_as<::sus::num::usize>;
+    };
+
+struct FlattenNoCount {};
+
+}  // namespace __private
+
 /// An iterator that flattens an iterator of iterable types into an iterator of
 /// those iterable types' items.
 ///
@@ -32,6 +60,15 @@ template <class EachIter, class InnerSizedIter>
 class [[nodiscard]] Flatten final
     : public IteratorBase<Flatten<EachIter, InnerSizedIter>,
                           typename EachIter::Item> {
+  using InnerItem = typename InnerSizedIter::Item;
+
+  // The number of items remaining is tracked when the lengths of all the
+  // iterables can be read up front.
+  static constexpr bool Counted =
+      __private::FlattenCountable<InnerSizedIter> &&
+      ExactSizeIterator<EachIter, typename EachIter::Item>;
+  using Count = std::conditional_t<Counted, usize, __private::FlattenNoCount>;
+
  public:
   using Item = typename EachIter::Item;
 
@@ -45,11 +82,179 @@ class [[nodiscard]] Flatten final
              ::sus::mem::Clone<EachIter>)
   {
     return Flatten(CLONE, ::sus::clone(iters_), ::sus::clone(front_iter_),
-                   ::sus::clone(back_iter_));
+                   ::sus::clone(back_iter_), remaining_);
   }
 
   // sus::iter::Iterator trait.
   constexpr Option<Item> next() noexcept {
+    Option<Item> out = pull_front();
+    if constexpr (Counted) {
+      if (out.is_some()) remaining_ -= 1u;
+    }
+    return out;
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    if constexpr (Counted) {
+      return SizeHint(remaining_, ::sus::some(remaining_));
+    } else {
+      auto [flo, fhi] = front_iter_.as_ref().map_or(
+          SizeHint(0u, ::sus::some(0u)),
+          [](const EachIter& i) { return i.size_hint(); });
+      auto [blo, bhi] = back_iter_.as_ref().map_or(
+          SizeHint(0u, ::sus::some(0u)),
+          [](const EachIter& i) { return i.size_hint(); });
+      return __private::flatten_size_hint<InnerItem>(
+          SizeHint(flo, ::sus::move(fhi)), SizeHint(blo, ::sus::move(bhi)),
+          iters_.size_hint());
+    }
+  }
+
+  /// sus::iter::ExactSizeIterator trait.
+  ///
+  /// The length is known when the iterables are held in contiguous memory and
+  /// can each report their length, such as when flattening a slice of `Vec`.
+  constexpr usize exact_size_hint() const noexcept
+    requires(Counted)
+  {
+    return remaining_;
+  }
+
+  /// sus::iter::TrustedLen trait.
+  ///
+  /// The length is known when each iterable has a size known from its type,
+  /// such as an [`Array`]($sus::collections::Array), or when the length of
+  /// each iterable can be read up front.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter> &&  //
+             (__private::ConstSizeIterable<
+                  std::remove_cvref_t<InnerItem>>::value ||
+              Counted))
+  {
+    return {};
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> next_back() noexcept
+    requires(DoubleEndedIterator<InnerSizedIter,
+                                 typename InnerSizedIter::Item> &&  //
+             DoubleEndedIterator<EachIter, Item>)
+  {
+    Option<Item> out = pull_back();
+    if constexpr (Counted) {
+      if (out.is_some()) remaining_ -= 1u;
+    }
+    return out;
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto flatten_fold = [&f](B acc, Item&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc),
+                                 ::sus::forward<Item>(item));
+    };
+    auto each_fold = [&flatten_fold](B acc, InnerItem&& each) -> B {
+      return each_iter(::sus::forward<InnerItem>(each)).template fold<B>(
+          ::sus::forward<B>(acc), flatten_fold);
+    };
+    B front_acc =
+        front_iter_.is_some()
+            ? ::sus::move(front_iter_)
+                  .unwrap_unchecked(::sus::marker::unsafe_fn)
+                  .template fold<B>(::sus::forward<B>(init), flatten_fold)
+            : ::sus::forward<B>(init);
+    B each_acc = ::sus::move(iters_).template fold<B>(
+        ::sus::forward<B>(front_acc), each_fold);
+    if (back_iter_.is_some()) {
+      return ::sus::move(back_iter_)
+          .unwrap_unchecked(::sus::marker::unsafe_fn)
+          .template fold<B>(::sus::forward<B>(each_acc), flatten_fold);
+    }
+    return each_acc;
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, InnerItem> &&  //
+             DoubleEndedIterator<EachIter, Item>)
+  constexpr B rfold(B init, F f) && noexcept {
+    auto flatten_fold = [&f](B acc, Item&& item) -> B {
+      return ::sus::fn::call_mut(f, ::sus::forward<B>(acc),
+                                 ::sus::forward<Item>(item));
+    };
+    auto each_fold = [&flatten_fold](B acc, InnerItem&& each) -> B {
+      return each_iter(::sus::forward<InnerItem>(each)).template rfold<B>(
+          ::sus::forward<B>(acc), flatten_fold);
+    };
+    B back_acc =
+        back_iter_.is_some()
+            ? ::sus::move(back_iter_)
+                  .unwrap_unchecked(::sus::marker::unsafe_fn)
+                  .template rfold<B>(::sus::forward<B>(init), flatten_fold)
+            : ::sus::forward<B>(init);
+    B each_acc = ::sus::move(iters_).template rfold<B>(
+        ::sus::forward<B>(back_acc), each_fold);
+    if (front_iter_.is_some()) {
+      return ::sus::move(front_iter_)
+          .unwrap_unchecked(::sus::marker::unsafe_fn)
+          .template rfold<B>(::sus::forward<B>(each_acc), flatten_fold);
+    }
+    return each_acc;
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto flatten_fold = [&f, &remaining = remaining_](B acc,
+                                                      Item&& item) -> R {
+      if constexpr (Counted)
+        remaining -= 1u;
+      else
+        (void)remaining;
+      return ::sus::fn::call_mut(f, ::sus::move(acc),
+                                 ::sus::forward<Item>(item));
+    };
+    if (front_iter_.is_some()) {
+      R out = front_iter_->try_fold(::sus::move(init), flatten_fold);
+      if (!::sus::ops::try_is_success(out)) return out;
+      init = ::sus::ops::try_into_output(::sus::move(out));
+    }
+    // Each inner iterator is held in `front_iter_` while it is folded, so that
+    // if the fold stops early, the rest of its items are still there.
+    auto each_fold = [&front = front_iter_, &flatten_fold](
+                         B acc, InnerItem&& each) -> R {
+      EachIter& iter =
+          front.insert(each_iter(::sus::forward<InnerItem>(each)));
+      return iter.try_fold(::sus::move(acc), flatten_fold);
+    };
+    R out = iters_.try_fold(::sus::move(init), each_fold);
+    if (!::sus::ops::try_is_success(out)) return out;
+    init = ::sus::ops::try_into_output(::sus::move(out));
+    front_iter_ = Option<EachIter>();
+    if (back_iter_.is_some()) {
+      out = back_iter_->try_fold(::sus::move(init), flatten_fold);
+      if (!::sus::ops::try_is_success(out)) return out;
+      init = ::sus::ops::try_into_output(::sus::move(out));
+      back_iter_ = Option<EachIter>();
+    }
+    return ::sus::ops::try_from_output<R>(::sus::move(init));
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  static constexpr EachIter each_iter(InnerItem&& each) noexcept {
+    return __private::flatten_each_iter(::sus::forward<InnerItem>(each));
+  }
+
+  constexpr Option<Item> pull_front() noexcept {
     Option<Item> out;
     while (true) {
       // Take an item off front_iter_ if possible.
@@ -59,8 +264,9 @@ class [[nodiscard]] Flatten final
         front_iter_ = Option<EachIter>();
       }
       // Otherwise grab the next iterator into front_iter_.
-      front_iter_ = iters_.next().map(
-          [](auto&& i) { return ::sus::move(i).into_iter(); });
+      front_iter_ = iters_.next().map([](InnerItem&& i) {
+        return each_iter(::sus::forward<InnerItem>(i));
+      });
       if (front_iter_.is_none()) break;
     }
     // There's no more iterator to place in front_iter_. Take an item off
@@ -74,27 +280,7 @@ class [[nodiscard]] Flatten final
     return out;
   }
 
-  /// sus::iter::Iterator trait.
-  constexpr SizeHint size_hint() const noexcept {
-    auto [flo, fhi] = front_iter_.as_ref().map_or(
-        SizeHint(0u, ::sus::some(0u)),
-        [](const EachIter& i) { return i.size_hint(); });
-    auto [blo, bhi] = back_iter_.as_ref().map_or(
-        SizeHint(0u, ::sus::some(0u)),
-        [](const EachIter& i) { return i.size_hint(); });
-    // Lower bound is the items in the iterators we can see.
-    usize lo = flo.saturating_add(blo);
-    // We have no upper bound if there's any other iterators left, and we can't
-    // tell if there's any iterators left without additional tracking state.
-    return SizeHint(lo, ::sus::Option<usize>());
-  }
-
-  // sus::iter::DoubleEndedIterator trait.
-  constexpr Option<Item> next_back() noexcept
-    requires(DoubleEndedIterator<InnerSizedIter,
-                                 typename InnerSizedIter::Item> &&  //
-             DoubleEndedIterator<EachIter, Item>)
-  {
+  constexpr Option<Item> pull_back() noexcept {
     Option<Item> out;
     while (true) {
       // Take an item off back_iter_ if possible.
@@ -104,8 +290,9 @@ class [[nodiscard]] Flatten final
         back_iter_ = Option<EachIter>();
       }
       // Otherwise grab the next iterator into back_iter_.
-      back_iter_ = iters_.next_back().map(
-          [](auto&& i) { return ::sus::move(i).into_iter(); });
+      back_iter_ = iters_.next_back().map([](InnerItem&& i) {
+        return each_iter(::sus::forward<InnerItem>(i));
+      });
       if (back_iter_.is_none()) break;
     }
     // There's no more iterator to place in back_iter_. Take an item off
@@ -119,30 +306,38 @@ class [[nodiscard]] Flatten final
     return out;
   }
 
- private:
-  template <class U, class V>
-  friend class IteratorBase;
-
   // Regular ctor.
   explicit constexpr Flatten(InnerSizedIter&& iters)
-      : iters_(::sus::move(iters)) {}
+      : iters_(::sus::move(iters)) {
+    if constexpr (Counted) {
+      // SAFETY: The pointer is only used to read the iterables remaining in
+      // `iters_`, before it is used again.
+      const auto* each = iters_.contiguous_data(::sus::marker::unsafe_fn);
+      const usize len = iters_.exact_size_hint();
+      for (usize i; i < len; i += 1u) remaining_ += each[size_t{i}].len();
+    }
+  }
   // Clone ctor.
   enum Clone { CLONE };
   explicit constexpr Flatten(Clone, InnerSizedIter&& iters,
                              ::sus::Option<EachIter>&& front,
-                             ::sus::Option<EachIter>&& back)
+                             ::sus::Option<EachIter>&& back, Count remaining)
       : iters_(::sus::move(iters)),
         front_iter_(::sus::move(front)),
-        back_iter_(::sus::move(back)) {}
+        back_iter_(::sus::move(back)),
+        remaining_(remaining) {}
 
   InnerSizedIter iters_;
   ::sus::Option<EachIter> front_iter_;
   ::sus::Option<EachIter> back_iter_;
+  // The number of items remaining in all the iterables, when `Counted`.
+  [[_sus_no_unique_address]] Count remaining_;
 
   sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
                                            decltype(iters_),
                                            decltype(front_iter_),
-                                           decltype(back_iter_));
+                                           decltype(back_iter_),
+                                           decltype(remaining_));
 };
 
 }  // namespace sus::iter
@@ -0,0 +1,160 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/collections/vec.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator that merges the elements of any number of sorted iterators
+/// into a single sorted iterator.
+///
+/// This type is returned from `Iterator::kmerge()` and `Iterator::kmerge_by()`.
+template <class InnerSizedIter, class CmpFn>
+class [[nodiscard]] KMergeBy final
+    : public IteratorBase<KMergeBy<InnerSizedIter, CmpFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  // Type is Move and (can be) Clone.
+  KMergeBy(KMergeBy&&) = default;
+  KMergeBy& operator=(KMergeBy&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr KMergeBy clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<CmpFn> &&           //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    auto heap = ::sus::collections::Vec<HeadTail>::with_capacity(heap_.len());
+    for (const HeadTail& ht : heap_) {
+      heap.push(HeadTail{::sus::clone(ht.head), ::sus::clone(ht.tail)});
+    }
+    return KMergeBy(::sus::clone(cmp_), ::sus::move(heap));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (heap_.is_empty()) return Option<Item>();
+    HeadTail& top = heap_[0u];
+    Option<Item> out = ::sus::mem::replace(top.head, top.tail.next());
+    if (top.head.is_none()) {
+      // The iterator at the top of the heap is exhausted, so it's replaced by
+      // the last one in the heap.
+      heap_.swap(0u, heap_.len() - 1u);
+      heap_.pop();
+    }
+    sift_down(0u);
+    return out;
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto lower = 0_usize;
+    auto upper = ::sus::Option<usize>(0u);
+    for (const HeadTail& ht : heap_) {
+      auto [tail_lower, tail_upper] = ht.tail.size_hint();
+      lower = lower.saturating_add(tail_lower).saturating_add(1u);
+      upper = upper.and_then([&tail_upper](usize u) {
+        return tail_upper.and_then([u](usize t) {
+          return u.checked_add(t).and_then(
+              [](usize s) { return s.checked_add(1u); });
+        });
+      });
+    }
+    return SizeHint(lower, upper);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  // An iterator along with the element that was last pulled from it, which
+  // is the key by which it's ordered in the heap.
+  struct HeadTail {
+    Option<Item> head;
+    InnerSizedIter tail;
+
+    sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                             decltype(head), decltype(tail));
+  };
+
+  // Constructs the iterator from an iterator over things that can be turned
+  // into `InnerSizedIter`.
+  template <class Iters>
+  static constexpr KMergeBy from_iters(CmpFn&& cmp, Iters&& iters) noexcept {
+    auto heap = ::sus::collections::Vec<HeadTail>::with_capacity(
+        iters.size_hint().lower);
+    for (auto&& each : iters) {
+      InnerSizedIter tail = ::sus::forward<decltype(each)>(each).into_iter();
+      Option<Item> head = tail.next();
+      if (head.is_some())
+        heap.push(HeadTail{::sus::move(head), ::sus::move(tail)});
+    }
+    return KMergeBy(::sus::move(cmp), ::sus::move(heap));
+  }
+
+  explicit constexpr KMergeBy(
+      CmpFn&& cmp, ::sus::collections::Vec<HeadTail>&& heap) noexcept
+      : cmp_(::sus::move(cmp)), heap_(::sus::move(heap)) {
+    // Heapify by sifting down each node with children, from the bottom up.
+    for (usize i = heap_.len() / 2u; i > 0u;) {
+      i -= 1u;
+      sift_down(i);
+    }
+  }
+
+  constexpr bool less(usize a, usize b) noexcept {
+    return ::sus::fn::call_mut(cmp_, heap_[a].head.as_value(),
+                               heap_[b].head.as_value()) < 0;
+  }
+
+  // Restores the min-heap property for the subtree rooted at `i`.
+  constexpr void sift_down(usize i) noexcept {
+    const usize len = heap_.len();
+    while (true) {
+      usize child = i * 2u + 1u;
+      if (child >= len) return;
+      if (child + 1u < len && less(child + 1u, child)) child += 1u;
+      if (!less(child, i)) return;
+      heap_.swap(i, child);
+      i = child;
+    }
+  }
+
+  CmpFn cmp_;
+  // A binary min-heap, ordered by each iterator's next element. Iterators are
+  // removed once they are exhausted.
+  ::sus::collections::Vec<HeadTail> heap_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(cmp_), decltype(heap_));
+};
+
+}  // namespace sus::iter
@@ -16,10 +16,17 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
@@ -62,6 +69,90 @@ class [[nodiscard]] Map final
     return next_iter_.next_back().map(fn_);
   }
 
+  /// sus::iter::Iterator trait.
+  ///
+  /// Pulls the next `N` items from the inner iterator as a chunk, which it may
+  /// be able to produce without checking each item for the end of the
+  /// iteration, and maps each of them.
+  template <size_t N>
+    requires(!std::is_reference_v<Item>)
+  constexpr ::sus::result::Result<::sus::collections::Array<Item, N>,
+                                  ::sus::collections::Array<Option<Item>, N>>
+  next_chunk() noexcept {
+    if constexpr (!std::is_reference_v<FromItem> &&
+                  !__private::TrustedRandomAccess<InnerSizedIter>) {
+      using Chunk = ::sus::collections::Array<Item, N>;
+      using Partial = ::sus::collections::Array<Option<Item>, N>;
+      using Out = ::sus::result::Result<Chunk, Partial>;
+      auto inner = next_iter_.template next_chunk<N>();
+      if (inner.is_ok()) {
+        auto from =
+            ::sus::move(inner).unwrap_unchecked(::sus::marker::unsafe_fn);
+        auto map_one = [this, &from, i = 0_usize]() mutable {
+          FromItem& item = from.get_unchecked_mut(
+              ::sus::marker::unsafe_fn, ::sus::mem::replace(i, i + 1u));
+          return ::sus::fn::call_mut(fn_, ::sus::move(item));
+        };
+        return Out(Chunk::with_initializer(map_one));
+      }
+      auto from =
+          ::sus::move(inner).unwrap_err_unchecked(::sus::marker::unsafe_fn);
+      Partial partial;
+      // The items pulled from the inner iterator are at the front of the
+      // array.
+      for (usize i; i < N; i += 1u) {
+        Option<FromItem>& o =
+            from.get_unchecked_mut(::sus::marker::unsafe_fn, i);
+        if (o.is_none()) break;
+        partial.get_unchecked_mut(::sus::marker::unsafe_fn, i) =
+            o.take().map(fn_);
+      }
+      return Out::with_err(::sus::move(partial));
+    } else {
+      // Random access iterators produce the chunk directly from the items.
+      return IteratorBase<Map, Item>::template next_chunk<N>();
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    auto map_fold = [&fn = fn_, &f](B acc, FromItem&& item) -> B {
+      return ::sus::fn::call_mut(
+          f, ::sus::forward<B>(acc),
+          ::sus::fn::call_mut(fn, ::sus::forward<FromItem>(item)));
+    };
+    return ::sus::move(next_iter_)
+        .template fold<B>(::sus::forward<B>(init), map_fold);
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(DoubleEndedIterator<InnerSizedIter, FromItem>)
+  constexpr B rfold(B init, F f) && noexcept {
+    auto map_fold = [&fn = fn_, &f](B acc, FromItem&& item) -> B {
+      return ::sus::fn::call_mut(
+          f, ::sus::forward<B>(acc),
+          ::sus::fn::call_mut(fn, ::sus::forward<FromItem>(item)));
+    };
+    return ::sus::move(next_iter_)
+        .template rfold<B>(::sus::forward<B>(init), map_fold);
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    auto map_fold = [&fn = fn_, &f](B acc, FromItem&& item) -> R {
+      return ::sus::fn::call_mut(
+          f, ::sus::move(acc),
+          ::sus::fn::call_mut(fn, ::sus::forward<FromItem>(item)));
+    };
+    return next_iter_.try_fold(::sus::move(init), map_fold);
+  }
+
   /// sus::iter::ExactSizeIterator trait.
   constexpr usize exact_size_hint() const noexcept
     requires(ExactSizeIterator<InnerSizedIter, FromItem>)
@@ -77,6 +168,46 @@ class [[nodiscard]] Map final
     return {};
   }
 
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    return ::sus::fn::call_mut(
+        fn_, next_iter_.get_unchecked(::sus::marker::unsafe_fn, i));
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept
+    requires(__private::TrustedRandomAccess<InnerSizedIter>)
+  {
+    next_iter_.advance_unchecked(::sus::marker::unsafe_fn, n);
+  }
+
+  /// Collects the mapped items into a `Vec` that reuses the allocation holding
+  /// the items of the inner iterator.
+  ///
+  /// # Safety
+  /// Must not be called in a constant expression.
+  /// #[doc.hidden]
+  ::sus::collections::Vec<Item> collect_vec_in_place(
+      ::sus::marker::UnsafeFnMarker) && noexcept
+    requires(__private::InPlaceSource<InnerSizedIter, Item>)
+  {
+    return ::sus::move(next_iter_)
+        .template map_collect_in_place<Item>(::sus::marker::unsafe_fn, fn_);
+  }
+
  private:
   template <class U, class V>
   friend class IteratorBase;
@@ -0,0 +1,103 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <compare>
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/peeked_pair.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator that merges the elements of two sorted iterators into a single
+/// sorted iterator.
+///
+/// This type is returned from `Iterator::merge()` and `Iterator::merge_by()`.
+template <class InnerSizedIter, class OtherSizedIter, class CmpFn>
+class [[nodiscard]] MergeBy final
+    : public IteratorBase<MergeBy<InnerSizedIter, OtherSizedIter, CmpFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static_assert(std::same_as<Item, typename OtherSizedIter::Item>);
+
+  // Type is Move and (can be) Clone.
+  MergeBy(MergeBy&&) = default;
+  MergeBy& operator=(MergeBy&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr MergeBy clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<OtherSizedIter> &&  //
+             ::sus::mem::Clone<CmpFn> &&           //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    return MergeBy(::sus::clone(cmp_), ::sus::clone(iters_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    Option<Item> a = iters_.next_a();
+    Option<Item> b = iters_.next_b();
+    if (a.is_none()) return b;
+    if (b.is_none()) return a;
+    // Elements from the first iterator come first when they are equal, which
+    // makes the merge stable.
+    if (::sus::fn::call_mut(cmp_, b.as_value(), a.as_value()) < 0) {
+      iters_.a_peeked = ::sus::move(a);
+      return b;
+    } else {
+      iters_.b_peeked = ::sus::move(b);
+      return a;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    return __private::add_size_hints(iters_.a_size_hint(),
+                                     iters_.b_size_hint());
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  using Iters = __private::PeekedPair<InnerSizedIter, OtherSizedIter>;
+
+  explicit constexpr MergeBy(CmpFn&& cmp, InnerSizedIter&& a,
+                             OtherSizedIter&& b) noexcept
+      : MergeBy(::sus::move(cmp), Iters(::sus::move(a), ::sus::move(b))) {}
+  explicit constexpr MergeBy(CmpFn&& cmp, Iters&& iters) noexcept
+      : cmp_(::sus::move(cmp)), iters_(::sus::move(iters)) {}
+
+  CmpFn cmp_;
+  Iters iters_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(cmp_), decltype(iters_));
+};
+
+}  // namespace sus::iter
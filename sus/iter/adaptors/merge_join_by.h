@@ -0,0 +1,111 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/cmp/ord.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/peeked_pair.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/tuple/tuple.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator that joins the elements of two sorted iterators, pairing up
+/// the elements that compare as equal.
+///
+/// This type is returned from `Iterator::merge_join_by()`.
+template <class InnerSizedIter, class OtherSizedIter, class CmpFn>
+class [[nodiscard]] MergeJoinBy final
+    : public IteratorBase<
+          MergeJoinBy<InnerSizedIter, OtherSizedIter, CmpFn>,
+          ::sus::Tuple<Option<typename InnerSizedIter::Item>,
+                       Option<typename OtherSizedIter::Item>>> {
+  using LeftItem = InnerSizedIter::Item;
+  using RightItem = OtherSizedIter::Item;
+
+ public:
+  using Item = ::sus::Tuple<Option<LeftItem>, Option<RightItem>>;
+
+  // Type is Move and (can be) Clone.
+  MergeJoinBy(MergeJoinBy&&) = default;
+  MergeJoinBy& operator=(MergeJoinBy&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr MergeJoinBy clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<OtherSizedIter> &&  //
+             ::sus::mem::Clone<CmpFn> &&           //
+             ::sus::mem::CloneOrRef<LeftItem> &&   //
+             ::sus::mem::CloneOrRef<RightItem>)
+  {
+    return MergeJoinBy(::sus::clone(cmp_), ::sus::clone(iters_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    Option<LeftItem> a = iters_.next_a();
+    Option<RightItem> b = iters_.next_b();
+    if (a.is_some() && b.is_some()) {
+      auto ord = ::sus::fn::call_mut(cmp_, a.as_value(), b.as_value());
+      if (ord < 0) {
+        iters_.b_peeked = b.take();
+      } else if (ord > 0) {
+        iters_.a_peeked = a.take();
+      }
+    } else if (a.is_none() && b.is_none()) {
+      return Option<Item>();
+    }
+    return Option<Item>(Item(::sus::move(a), ::sus::move(b)));
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    // Each element produced holds at least one element from either iterator,
+    // and at most one from each.
+    SizeHint a = iters_.a_size_hint();
+    SizeHint b = iters_.b_size_hint();
+    usize lower = ::sus::cmp::max(a.lower, b.lower);
+    return SizeHint(lower, __private::add_size_hints(a, b).upper);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  using Iters = __private::PeekedPair<InnerSizedIter, OtherSizedIter>;
+
+  explicit constexpr MergeJoinBy(CmpFn&& cmp, InnerSizedIter&& a,
+                                 OtherSizedIter&& b) noexcept
+      : MergeJoinBy(::sus::move(cmp), Iters(::sus::move(a), ::sus::move(b))) {
+  }
+  explicit constexpr MergeJoinBy(CmpFn&& cmp, Iters&& iters) noexcept
+      : cmp_(::sus::move(cmp)), iters_(::sus::move(iters)) {}
+
+  CmpFn cmp_;
+  Iters iters_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(cmp_), decltype(iters_));
+};
+
+}  // namespace sus::iter
@@ -16,6 +16,10 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <stddef.h>
+
+#include "sus/assertions/check.h"
+#include "sus/collections/array.h"
 #include "sus/iter/iterator_defn.h"
 #include "sus/mem/clone.h"
 #include "sus/mem/move.h"
@@ -187,4 +191,184 @@ class [[nodiscard]] Peekable final
                                            decltype(next_iter_));
 };
 
+/// An iterator with a `peek_nth()` that returns an optional reference to any of
+/// the next `N` elements.
+///
+/// The peeked elements are held in a ring buffer of size `N` inside the
+/// iterator, so no memory is allocated.
+///
+/// This type is returned from `Iterator::peekable<N>()`.
+template <class InnerSizedIter, size_t N>
+class [[nodiscard]] PeekableN final
+    : public IteratorBase<PeekableN<InnerSizedIter, N>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  // Type is Move and (can be) Clone.
+  PeekableN(PeekableN&&) = default;
+  PeekableN& operator=(PeekableN&&) = default;
+
+  /// sus::mem::Clone implementation
+  constexpr PeekableN clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    return PeekableN(CLONE, ::sus::clone(buffer_), head_, len_,
+                     ::sus::clone(next_iter_));
+  }
+
+  /// Returns a const reference to the `next()` value without advancing the
+  /// iterator.
+  ///
+  /// This is the same as `peek_nth(0u)`.
+  constexpr Option<const std::remove_reference_t<Item>&> peek() noexcept {
+    return peek_nth(0u);
+  }
+
+  /// Returns a mutable reference to the `next()` value without advancing the
+  /// iterator.
+  ///
+  /// This is the same as `peek_nth_mut(0u)`.
+  constexpr Option<Item&> peek_mut() noexcept { return peek_nth_mut(0u); }
+
+  /// Returns a const reference to the `n`th value that `next()` will return,
+  /// counting from zero, without advancing the iterator.
+  ///
+  /// If the iteration ends before the `n`th value, `None` is returned.
+  ///
+  /// # Panics
+  /// Panics if `n` is not less than `N`, as the element can not be held in
+  /// the lookahead buffer.
+  constexpr Option<const std::remove_reference_t<Item>&> peek_nth(
+      usize n) noexcept {
+    sus_check_with_message(n < N, "peek_nth() index beyond lookahead size");
+    if (!fill(n)) return Option<const std::remove_reference_t<Item>&>();
+    return buffer_[slot(n)].as_ref();
+  }
+
+  /// Returns a mutable reference to the `n`th value that `next()` will return,
+  /// counting from zero, without advancing the iterator.
+  ///
+  /// If the iteration ends before the `n`th value, `None` is returned.
+  ///
+  /// # Panics
+  /// Panics if `n` is not less than `N`, as the element can not be held in
+  /// the lookahead buffer.
+  constexpr Option<Item&> peek_nth_mut(usize n) noexcept {
+    sus_check_with_message(n < N, "peek_nth_mut() index beyond lookahead size");
+    if (!fill(n)) return Option<Item&>();
+    return buffer_[slot(n)].as_mut();
+  }
+
+  /// Consume and return the next value of this iterator if a condition is true.
+  ///
+  /// If `func` returns `true` for the next value of this iterator, consume and
+  /// return it. Otherwise, return `None`.
+  constexpr Option<Item> next_if(
+      ::sus::fn::FnOnce<bool(const std::remove_reference_t<Item>&)> auto
+          pred) noexcept {
+    if (!fill(0u)) return Option<Item>();
+    if (!::sus::fn::call_once(::sus::move(pred),
+                              buffer_[head_].as_value())) {
+      return Option<Item>();
+    }
+    return next();
+  }
+
+  /// Consume and return the next item if it is equal to `expected`.
+  constexpr Option<Item> next_if_eq(
+      const std::remove_reference_t<Item>& expected) noexcept
+    requires(::sus::cmp::Eq<Item>)
+  {
+    return next_if([&](const auto& i) { return i == expected; });
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (len_ == 0u) return next_iter_.next();
+    Option<Item> out = buffer_[head_].take();
+    head_ = slot(1u);
+    len_ -= 1u;
+    return out;
+  }
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto [lo, hi] = next_iter_.size_hint();
+    return SizeHint(
+        lo.saturating_add(len_),
+        hi.and_then([this](usize i) { return i.checked_add(len_); }));
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> next_back() noexcept
+    requires(DoubleEndedIterator<InnerSizedIter, Item>)
+  {
+    return next_iter_.next_back().or_else([this] {
+      if (len_ == 0u) return Option<Item>();
+      len_ -= 1u;
+      return buffer_[slot(len_)].take();
+    });
+  }
+
+  /// sus::iter::ExactSizeIterator trait.
+  constexpr usize exact_size_hint() const noexcept
+    requires(ExactSizeIterator<InnerSizedIter, Item>)
+  {
+    return len_ + next_iter_.exact_size_hint();
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter>)
+  {
+    return {};
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  // Regular ctor.
+  explicit constexpr PeekableN(InnerSizedIter&& next_iter)
+      : next_iter_(::sus::move(next_iter)) {}
+  // Clone ctor.
+  enum Clone { CLONE };
+  explicit constexpr PeekableN(
+      Clone, ::sus::collections::Array<Option<Item>, N>&& buffer, usize head,
+      usize len, InnerSizedIter&& next_iter)
+      : buffer_(::sus::move(buffer)),
+        head_(head),
+        len_(len),
+        next_iter_(::sus::move(next_iter)) {}
+
+  // The index in `buffer_` of the `i`th buffered element.
+  constexpr usize slot(usize i) const noexcept { return (head_ + i) % N; }
+
+  // Pulls elements from `next_iter_` until the `n`th element is buffered.
+  // Returns false if `next_iter_` ends first.
+  constexpr bool fill(usize n) noexcept {
+    while (len_ <= n) {
+      Option<Item> o = next_iter_.next();
+      if (o.is_none()) return false;
+      buffer_[slot(len_)] = ::sus::move(o);
+      len_ += 1u;
+    }
+    return true;
+  }
+
+  // A ring buffer of the `len_` elements which were pulled from `next_iter_`
+  // but not yet returned, starting at `head_`.
+  ::sus::collections::Array<Option<Item>, N> buffer_;
+  usize head_;
+  usize len_;
+  InnerSizedIter next_iter_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(buffer_), decltype(head_),
+                                           decltype(len_),
+                                           decltype(next_iter_));
+};
+
 }  // namespace sus::iter
@@ -0,0 +1,219 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/prefetch.h"
+#include "sus/iter/iterator_concept.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+/// An iterator that prefetches memory for the items a fixed distance ahead of
+/// the item being yielded.
+///
+/// The memory to prefetch for each item is chosen by a function, which receives
+/// a reference to the item and returns a pointer. The inner iterator is cloned
+/// in order to look ahead, so it should be cheap to clone.
+///
+/// For an iterator over a contiguous array, `PrefetchContiguous` finds the
+/// items ahead without a second iterator.
+///
+/// This type is returned from `Iterator::prefetch_by()`.
+template <class InnerSizedIter, class AddrFn>
+class [[nodiscard]] Prefetch final
+    : public IteratorBase<Prefetch<InnerSizedIter, AddrFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = typename InnerSizedIter::Item;
+
+  static_assert(::sus::mem::Clone<InnerSizedIter>);
+  static_assert(
+      ::sus::fn::FnMut<AddrFn,
+                       const void*(const std::remove_reference_t<Item>&)>);
+
+  // Type is Move and (can be) Clone.
+  Prefetch(Prefetch&&) = default;
+  Prefetch& operator=(Prefetch&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr Prefetch clone() const noexcept
+    requires(::sus::mem::Clone<AddrFn>)
+  {
+    return Prefetch(CLONE, ::sus::clone(addr_fn_), ::sus::clone(ahead_iter_),
+                    ::sus::clone(next_iter_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    prefetch_next_ahead();
+    return next_iter_.next();
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    return next_iter_.size_hint();
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  constexpr usize exact_size_hint() const noexcept
+    requires(ExactSizeIterator<InnerSizedIter, Item>)
+  {
+    return next_iter_.exact_size_hint();
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter>)
+  {
+    return {};
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  explicit constexpr Prefetch(AddrFn&& fn, usize distance,
+                              InnerSizedIter&& next_iter)
+      : addr_fn_(::sus::move(fn)),
+        ahead_iter_(::sus::clone(next_iter)),
+        next_iter_(::sus::move(next_iter)) {
+    // The items before `distance` will be yielded first, so they are fetched
+    // right away to be ready in time.
+    for (usize i; i < distance; i += 1u) prefetch_next_ahead();
+  }
+  enum Clone { CLONE };
+  constexpr Prefetch(Clone, AddrFn&& fn, InnerSizedIter&& ahead_iter,
+                     InnerSizedIter&& next_iter)
+      : addr_fn_(::sus::move(fn)),
+        ahead_iter_(::sus::move(ahead_iter)),
+        next_iter_(::sus::move(next_iter)) {}
+
+  constexpr void prefetch_next_ahead() noexcept {
+    if (Option<Item> ahead = ahead_iter_.next(); ahead.is_some()) {
+      __private::prefetch(::sus::fn::call_mut(
+          addr_fn_, static_cast<const std::remove_reference_t<Item>&>(
+                        ahead.as_value())));
+    }
+  }
+
+  AddrFn addr_fn_;
+  InnerSizedIter ahead_iter_;
+  InnerSizedIter next_iter_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(addr_fn_),
+                                           decltype(ahead_iter_),
+                                           decltype(next_iter_));
+};
+
+/// An iterator over a contiguous array that prefetches the item a fixed
+/// distance ahead of the item being yielded.
+///
+/// The item to prefetch is found by offsetting the pointer to the front of the
+/// inner iterator, so there is no second iterator to step through the items.
+///
+/// This type is returned from `SliceIter::prefetch()` and
+/// `SliceIterMut::prefetch()`.
+template <class InnerSizedIter>
+class [[nodiscard]] PrefetchContiguous final
+    : public IteratorBase<PrefetchContiguous<InnerSizedIter>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = typename InnerSizedIter::Item;
+
+  static_assert(__private::ContiguousIterator<InnerSizedIter,
+                                             std::remove_cvref_t<Item>>);
+
+  // Type is Move and (can be) Clone.
+  PrefetchContiguous(PrefetchContiguous&&) = default;
+  PrefetchContiguous& operator=(PrefetchContiguous&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr PrefetchContiguous clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter>)
+  {
+    return PrefetchContiguous(CLONE, ::sus::clone(next_iter_), distance_);
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    prefetch_ahead(distance_);
+    return next_iter_.next();
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    return next_iter_.size_hint();
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  constexpr usize exact_size_hint() const noexcept {
+    return next_iter_.exact_size_hint();
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter>)
+  {
+    return {};
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+  // The contiguous iterators construct this type from their `prefetch()`.
+  friend InnerSizedIter;
+
+  explicit constexpr PrefetchContiguous(InnerSizedIter&& next_iter,
+                                        usize distance)
+      : next_iter_(::sus::move(next_iter)), distance_(distance) {
+    // The items before `distance` will be yielded first, so they are fetched
+    // right away to be ready in time.
+    usize len = next_iter_.exact_size_hint();
+    for (usize i; i < distance && i < len; i += 1u) prefetch_ahead(i);
+  }
+  enum Clone { CLONE };
+  constexpr PrefetchContiguous(Clone, InnerSizedIter&& next_iter,
+                               usize distance)
+      : next_iter_(::sus::move(next_iter)), distance_(distance) {}
+
+  // Prefetches the item `ahead` steps from the front, if it is in the array.
+  constexpr void prefetch_ahead(usize ahead) noexcept {
+    if (ahead < next_iter_.exact_size_hint()) {
+      __private::prefetch(
+          next_iter_.contiguous_data(::sus::marker::unsafe_fn) + ahead);
+    }
+  }
+
+  InnerSizedIter next_iter_;
+  usize distance_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(next_iter_),
+                                           decltype(distance_));
+};
+
+}  // namespace sus::iter
@@ -16,12 +16,16 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_concept.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
+#include "sus/ops/try.h"
 
 namespace sus::iter {
 
@@ -59,6 +63,35 @@ class [[nodiscard]] Reverse final
   }
   /// sus::iter::DoubleEndedIterator trait.
   constexpr Option<Item> next_back() noexcept { return next_iter_.next(); }
+  /// sus::iter::Iterator trait.
+  constexpr Option<Item> nth(usize n) noexcept {
+    return next_iter_.nth_back(n);
+  }
+  /// sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> nth_back(usize n) noexcept {
+    return next_iter_.nth(n);
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    return ::sus::move(next_iter_)
+        .template rfold<B>(::sus::forward<B>(init), ::sus::move(f));
+  }
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B rfold(B init, F f) && noexcept {
+    return ::sus::move(next_iter_)
+        .template fold<B>(::sus::forward<B>(init), ::sus::move(f));
+  }
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, Item&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    return next_iter_.try_rfold(::sus::move(init), ::sus::move(f));
+  }
   /// sus::iter::ExactSizeIterator trait.
   constexpr usize exact_size_hint() const noexcept
     requires(ExactSizeIterator<InnerSizedIter, Item>)
@@ -0,0 +1,101 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/cmp/ord.h"
+#include "sus/iter/__private/peeked_pair.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator over the sorted union of two sorted iterators.
+///
+/// This type is returned from `Iterator::sorted_union()`.
+template <class InnerSizedIter, class OtherSizedIter>
+class [[nodiscard]] SortedUnion final
+    : public IteratorBase<SortedUnion<InnerSizedIter, OtherSizedIter>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static_assert(std::same_as<Item, typename OtherSizedIter::Item>);
+
+  // Type is Move and (can be) Clone.
+  SortedUnion(SortedUnion&&) = default;
+  SortedUnion& operator=(SortedUnion&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr SortedUnion clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<OtherSizedIter> &&  //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    return SortedUnion(::sus::clone(iters_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    Option<Item> a = iters_.next_a();
+    Option<Item> b = iters_.next_b();
+    if (a.is_none()) return b;
+    if (b.is_none()) return a;
+    auto ord = a.as_value() <=> b.as_value();
+    if (ord < 0) {
+      iters_.b_peeked = ::sus::move(b);
+      return a;
+    } else if (ord > 0) {
+      iters_.a_peeked = ::sus::move(a);
+      return b;
+    } else {
+      // Equal elements are returned once, from the first iterator.
+      return a;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    SizeHint a = iters_.a_size_hint();
+    SizeHint b = iters_.b_size_hint();
+    usize lower = ::sus::cmp::max(a.lower, b.lower);
+    return SizeHint(lower, __private::add_size_hints(a, b).upper);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  using Iters = __private::PeekedPair<InnerSizedIter, OtherSizedIter>;
+
+  explicit constexpr SortedUnion(InnerSizedIter&& a,
+                                 OtherSizedIter&& b) noexcept
+      : iters_(::sus::move(a), ::sus::move(b)) {}
+  explicit constexpr SortedUnion(Iters&& iters) noexcept
+      : iters_(::sus::move(iters)) {}
+
+  Iters iters_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(iters_));
+};
+
+}  // namespace sus::iter
@@ -47,17 +47,11 @@ class [[nodiscard]] StepBy final
 
   // sus::iter::Iterator trait.
   constexpr Option<Item> next() noexcept {
-    Option<Item> out = next_iter_.next();
     if (first_take_) {
       first_take_ = false;
-    } else {
-      // TODO: If SizedIterator satisifies Iterator we can use nth(n).
-      for (usize i; i < step_; i += 1u) {
-        if (out.is_none()) return out;
-        out = next_iter_.next();
-      }
+      return next_iter_.next();
     }
-    return out;
+    return next_iter_.nth(step_);
   }
   /// sus::iter::Iterator trait.
   constexpr SizeHint size_hint() const noexcept {
@@ -84,15 +78,7 @@ class [[nodiscard]] StepBy final
     requires(DoubleEndedIterator<InnerSizedIter, Item> &&  //
              ExactSizeIterator<InnerSizedIter, Item>)
   {
-    // TODO: If SizedIterator satisifies Iterator we can use
-    // nth_back(n).
-    const usize n = next_back_index();
-    Option<Item> out = next_iter_.next_back();
-    for (usize i; i < n; i += 1u) {
-      if (out.is_none()) return out;
-      out = next_iter_.next_back();
-    }
-    return out;
+    return next_iter_.nth_back(next_back_index());
   }
 
   // sus::iter::ExactSizeIterator trait.
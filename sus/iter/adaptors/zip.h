@@ -16,8 +16,15 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/macros/no_unique_address.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/addressof.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 
@@ -79,11 +86,38 @@ inline constexpr usize exact_size_hints(auto& iters) noexcept {
   }
 }
 
+template <class TupleItem, size_t... Is>
+inline constexpr TupleItem get_uncheckeds(auto& iters, usize i,
+                                          std::index_sequence<Is...>) noexcept {
+  return TupleItem(iters.template at_mut<Is>().get_unchecked(
+      ::sus::marker::unsafe_fn, i)...);
+}
+
+/// The position of a `Zip` over iterators which are all
+/// `TrustedRandomAccess`. The inner iterators are not advanced, instead they
+/// are indexed at `index`, up to the shortest of their lengths, `len`.
+struct ZipIndex {
+  usize index;
+  usize len;
+};
+struct ZipNoIndex {};
+
 }  // namespace __private
 
 /// An iterator that iterates a group of other iterators simultaneously.
 ///
 /// This type is returned from `Iterator::zip()`.
+///
+/// When all of the zipped iterators can be accessed by index, such as when
+/// zipping iterators over slices, the `Zip` keeps a single counter and indexes
+/// each of the iterators, which produces a single counted loop instead of
+/// checking each iterator for its end.
+///
+/// When the zipped iterators have different lengths, the indexed path only
+/// produces items up to the length of the shortest iterator. Stepping with
+/// `next()` would have pulled one more item from each iterator that comes
+/// before the shortest one, so side effects of producing those items, such as
+/// in the function given to `map()`, do not happen on the indexed path.
 template <class... InnerSizedIters>
 class [[nodiscard]] Zip final
     : public IteratorBase<Zip<InnerSizedIters...>,
@@ -91,6 +125,13 @@ class [[nodiscard]] Zip final
  public:
   using Item = sus::Tuple<__private::GetItem<InnerSizedIters>...>;
 
+ private:
+  static constexpr bool RandomAccess =
+      (... && __private::TrustedRandomAccess<InnerSizedIters>);
+  using Index = std::conditional_t<RandomAccess, __private::ZipIndex,
+                                   __private::ZipNoIndex>;
+
+ public:
   // Type is Move and (can be) Clone.
   constexpr Zip(Zip&&) = default;
   Zip& operator=(Zip&&) = default;
@@ -99,16 +140,52 @@ class [[nodiscard]] Zip final
   constexpr Zip clone() const noexcept
     requires((... && ::sus::mem::Clone<InnerSizedIters>))
   {
-    return Zip(::sus::clone(iters_));
+    return Zip(::sus::clone(iters_), index_);
   }
 
   // sus::iter::Iterator trait.
   constexpr Option<Item> next() noexcept {
-    return __private::nexts<Item, sizeof...(InnerSizedIters)>(iters_);
+    if constexpr (RandomAccess) {
+      if (index_.index == index_.len) return Option<Item>();
+      const usize i = index_.index;
+      index_.index += 1u;
+      return Option<Item>(get_unchecked_at(i));
+    } else {
+      return __private::nexts<Item, sizeof...(InnerSizedIters)>(iters_);
+    }
   }
   /// sus::iter::Iterator trait.
   constexpr SizeHint size_hint() const noexcept {
-    return __private::size_hints<0, sizeof...(InnerSizedIters)>(iters_);
+    if constexpr (RandomAccess) {
+      const usize remaining = index_.len - index_.index;
+      return SizeHint(remaining, ::sus::some(remaining));
+    } else {
+      return __private::size_hints<0, sizeof...(InnerSizedIters)>(iters_);
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// When all of the zipped iterators can be accessed by index, the items are
+  /// folded in a single counted loop.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    if constexpr (RandomAccess) {
+      if constexpr (std::is_reference_v<B>) {
+        std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+        for (usize i = index_.index; i < index_.len; i += 1u)
+          out = ::sus::mem::addressof(
+              ::sus::fn::call_mut(f, *out, get_unchecked_at(i)));
+        return *out;
+      } else {
+        for (usize i = index_.index; i < index_.len; i += 1u)
+          init = ::sus::fn::call_mut(f, ::sus::move(init), get_unchecked_at(i));
+        return init;
+      }
+    } else {
+      return static_cast<IteratorBase<Zip, Item>&&>(*this).template fold<B>(
+          ::sus::forward<B>(init), ::sus::move(f));
+    }
   }
 
   // sus::iter::ExactSizeIterator trait.
@@ -117,7 +194,12 @@ class [[nodiscard]] Zip final
         (... &&
          ExactSizeIterator<InnerSizedIters, typename InnerSizedIters::Item>))
   {
-    return __private::exact_size_hints<0, sizeof...(InnerSizedIters)>(iters_);
+    if constexpr (RandomAccess) {
+      return index_.len - index_.index;
+    } else {
+      return __private::exact_size_hints<0, sizeof...(InnerSizedIters)>(
+          iters_);
+    }
   }
 
   /// sus::iter::TrustedLen trait.
@@ -128,17 +210,59 @@ class [[nodiscard]] Zip final
     return {};
   }
 
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedRandomAccessMarker
+  trusted_random_access() const noexcept
+    requires(RandomAccess)
+  {
+    return {};
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr Item get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) noexcept
+    requires(RandomAccess)
+  {
+    return get_unchecked_at(index_.index + i);
+  }
+  /// sus::iter::TrustedRandomAccess trait.
+  /// #[doc.hidden]
+  constexpr void advance_unchecked(::sus::marker::UnsafeFnMarker,
+                                   usize n) noexcept
+    requires(RandomAccess)
+  {
+    index_.index += n;
+  }
+
  private:
   template <class U, class V>
   friend class IteratorBase;
 
   explicit constexpr Zip(::sus::Tuple<InnerSizedIters...>&& iters) noexcept
-      : iters_(::sus::move(iters)) {}
+      : iters_(::sus::move(iters)) {
+    if constexpr (RandomAccess) {
+      index_.index = 0u;
+      index_.len =
+          __private::exact_size_hints<0, sizeof...(InnerSizedIters)>(iters_);
+    }
+  }
+  explicit constexpr Zip(::sus::Tuple<InnerSizedIters...>&& iters,
+                         Index index) noexcept
+      : iters_(::sus::move(iters)), index_(index) {}
+
+  /// Returns the items at `i` from each of the iterators, which must be less
+  /// than `index_.len`.
+  constexpr Item get_unchecked_at(usize i) noexcept {
+    return __private::get_uncheckeds<Item>(
+        iters_, i, std::index_sequence_for<InnerSizedIters...>());
+  }
 
   ::sus::Tuple<InnerSizedIters...> iters_;
+  [[_sus_no_unique_address]] Index index_;
 
   sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
-                                           decltype(iters_));
+                                           decltype(iters_), decltype(index_));
 };
 
 }  // namespace sus::iter
@@ -0,0 +1,446 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/assertions/unreachable.h"
+#include "sus/collections/vec.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/generator_frame.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::iter {
+
+template <class T>
+class AsyncGenerator;
+template <class T>
+class AsyncTask;
+
+/// A concept for types that produce a sequence of items asynchronously.
+///
+/// An `AsyncIterator` is like an [`Iterator`]($sus::iter::Iterator), but its
+/// `next()` method returns an awaitable, which produces an `Option<Item>` when
+/// it is `co_await`ed from a coroutine. While waiting for the next item, the
+/// awaiting coroutine is suspended instead of blocking the thread.
+///
+/// [`AsyncGenerator`]($sus::iter::AsyncGenerator) satisfies `AsyncIterator`.
+template <class T, class Item>
+concept AsyncIterator = requires(T& t) {
+  { t.next().await_ready() } -> std::same_as<bool>;
+  { t.next().await_resume() } -> std::same_as<::sus::Option<Item>>;
+};
+
+namespace __private {
+
+template <class T>
+struct IsAsyncTask : std::false_type {};
+template <class T>
+struct IsAsyncTask<AsyncTask<T>> : std::true_type {};
+
+/// Suspends an `AsyncGenerator` and resumes the coroutine that is awaiting its
+/// next item.
+struct ResumeConsumer {
+  constexpr bool await_ready() const noexcept { return false; }
+  template <class Promise>
+  std::coroutine_handle<> await_suspend(
+      std::coroutine_handle<Promise> h) const noexcept {
+    return h.promise().consumer_;
+  }
+  constexpr void await_resume() const noexcept {}
+};
+
+template <class T>
+class AsyncIterPromise : public FrameAllocatingPromise {
+ public:
+  AsyncGenerator<T> get_return_object() noexcept {
+    return AsyncGenerator<T>(*this);
+  }
+
+  auto yield_value(const T& v) noexcept
+    requires(::sus::mem::Copy<T>)
+  {
+    yielded_.insert(v);
+    return ResumeConsumer();
+  }
+  auto yield_value(T&& v) noexcept
+    requires(::sus::mem::Move<T>)
+  {
+    yielded_.insert(::sus::move(v));
+    return ResumeConsumer();
+  }
+
+  // Returning yields None to the consumer, as `yielded_` is empty.
+  constexpr void return_void() noexcept {}
+
+  constexpr std::suspend_always initial_suspend() noexcept { return {}; }
+  constexpr ResumeConsumer final_suspend() noexcept { return {}; }
+  constexpr void unhandled_exception() noexcept { sus_unreachable(); }
+
+  constexpr Option<T> take() & noexcept { return yielded_.take(); }
+
+ private:
+  friend struct ResumeConsumer;
+  template <class U>
+  friend class AsyncNext;
+
+  // The coroutine awaiting the next item, which is resumed when the generator
+  // yields or returns.
+  std::coroutine_handle<> consumer_;
+  Option<T> yielded_;
+};
+
+/// The awaitable returned from `AsyncGenerator::next()`.
+template <class T>
+class [[nodiscard]] AsyncNext {
+ public:
+  explicit AsyncNext(std::coroutine_handle<AsyncIterPromise<T>> h) noexcept
+      : co_handle_(h) {}
+
+  bool await_ready() const noexcept { return co_handle_.done(); }
+  std::coroutine_handle<> await_suspend(
+      std::coroutine_handle<> consumer) const noexcept {
+    co_handle_.promise().consumer_ = consumer;
+    return co_handle_;
+  }
+  Option<T> await_resume() const noexcept {
+    return co_handle_.promise().take();
+  }
+
+ private:
+  std::coroutine_handle<AsyncIterPromise<T>> co_handle_;
+};
+
+/// Suspends a finished `AsyncTask` and resumes the coroutine awaiting it, if
+/// there is one.
+struct ResumeContinuation {
+  constexpr bool await_ready() const noexcept { return false; }
+  template <class Promise>
+  std::coroutine_handle<> await_suspend(
+      std::coroutine_handle<Promise> h) const noexcept {
+    if (std::coroutine_handle<> c = h.promise().continuation_; c != nullptr)
+      return c;
+    return std::noop_coroutine();
+  }
+  constexpr void await_resume() const noexcept {}
+};
+
+template <class T>
+class AsyncTaskPromise : public FrameAllocatingPromise {
+ public:
+  AsyncTask<T> get_return_object() noexcept { return AsyncTask<T>(*this); }
+
+  void return_value(const T& v) noexcept
+    requires(::sus::mem::Copy<T>)
+  {
+    result_.insert(v);
+  }
+  void return_value(T&& v) noexcept
+    requires(::sus::mem::Move<T>)
+  {
+    result_.insert(::sus::move(v));
+  }
+
+  // The task starts running when it's created.
+  constexpr std::suspend_never initial_suspend() noexcept { return {}; }
+  constexpr ResumeContinuation final_suspend() noexcept { return {}; }
+  constexpr void unhandled_exception() noexcept { sus_unreachable(); }
+
+ private:
+  friend struct ResumeContinuation;
+  friend class AsyncTask<T>;
+
+  // The coroutine awaiting the result, which is resumed when the task returns.
+  std::coroutine_handle<> continuation_;
+  Option<T> result_;
+};
+
+}  // namespace __private
+
+/// A coroutine that computes a single value of type `T` asynchronously.
+///
+/// To implement a task, write a coroutine function that returns
+/// `sus::iter::AsyncTask<T>` and `co_return`s a `T`. The coroutine may
+/// `co_await` other awaitables, such as an
+/// [`AsyncGenerator`]($sus::iter::AsyncGenerator)'s
+/// [`next()`]($sus::iter::AsyncGenerator::next), another `AsyncTask`, or an
+/// executor's I/O readiness.
+///
+/// Unlike a [`Generator`]($sus::iter::Generator), a task starts running as
+/// soon as it is called, and runs until it first suspends. This allows
+/// multiple tasks to be waiting on I/O at the same time, such as with
+/// [`AsyncGenerator::buffered`]($sus::iter::AsyncGenerator::buffered). Its
+/// result is received by `co_await`ing the task from another coroutine, or by
+/// calling [`unwrap`]($sus::iter::AsyncTask::unwrap) once it
+/// [`is_done`]($sus::iter::AsyncTask::is_done), such as from the code running
+/// the executor.
+///
+/// Destroying a task that is not done destroys its coroutine, so whatever it
+/// is awaiting must not resume it afterward.
+template <class T>
+class [[nodiscard]] [[_sus_trivial_abi]] AsyncTask final {
+  static_assert(!std::is_void_v<T> && !std::is_reference_v<T>);
+
+ public:
+  // Coroutine implementation.
+  using promise_type = __private::AsyncTaskPromise<T>;
+
+  /// The type produced by the task.
+  using Output = T;
+
+  ~AsyncTask() noexcept {
+    if (co_handle_ != nullptr) co_handle_.destroy();
+  }
+
+  /// sus::mem::Move trait.
+  AsyncTask(AsyncTask&& o) noexcept
+      : co_handle_(::sus::mem::replace(o.co_handle_, nullptr)) {
+    sus_check(co_handle_ != nullptr);
+  }
+  /// sus::mem::Move trait.
+  AsyncTask& operator=(AsyncTask&& o) noexcept {
+    if (co_handle_ != nullptr) co_handle_.destroy();
+    co_handle_ = ::sus::mem::replace(o.co_handle_, nullptr);
+    sus_check(co_handle_ != nullptr);
+    return *this;
+  }
+
+  /// Returns whether the task has returned its result.
+  bool is_done() const noexcept { return co_handle_.done(); }
+
+  /// Returns the result of the task.
+  ///
+  /// # Panics
+  /// Panics if the task is not done.
+  T unwrap() && noexcept {
+    sus_check(is_done());
+    return co_handle_.promise().result_.take().unwrap_unchecked(
+        ::sus::marker::unsafe_fn);
+  }
+
+  /// Awaits the result of the task, suspending the awaiting coroutine until
+  /// the task is done.
+  auto operator co_await() && noexcept {
+    struct Awaiter {
+      bool await_ready() const noexcept { return h.done(); }
+      void await_suspend(std::coroutine_handle<> c) const noexcept {
+        h.promise().continuation_ = c;
+      }
+      T await_resume() const noexcept {
+        return h.promise().result_.take().unwrap_unchecked(
+            ::sus::marker::unsafe_fn);
+      }
+      std::coroutine_handle<promise_type> h;
+    };
+    return Awaiter(co_handle_);
+  }
+
+ private:
+  friend promise_type;
+
+  explicit AsyncTask(promise_type& p) noexcept
+      : co_handle_(std::coroutine_handle<promise_type>::from_promise(p)) {}
+
+  std::coroutine_handle<promise_type> co_handle_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(co_handle_));
+};
+
+/// A coroutine generator type that is an
+/// [`AsyncIterator`]($sus::iter::AsyncIterator) over type `T`.
+///
+/// To implement an async generator, write a coroutine function that returns
+/// `sus::iter::AsyncGenerator<T>`. The function can `co_yield` values of type
+/// `T`, and can `co_await` other awaitables, such as an executor's I/O
+/// readiness, between them.
+///
+/// The generator does not run until its next item is requested, by
+/// `co_await`ing [`next()`]($sus::iter::AsyncGenerator::next) from another
+/// coroutine. That coroutine is suspended until the generator yields an item
+/// or returns.
+///
+/// # Example
+/// ```
+/// auto pages = [](Client& c) -> AsyncGenerator<Page> {
+///   for (Option<Token> t = sus::some(Token()); t.is_some();) {
+///     Page p = co_await c.fetch(*t);
+///     t = p.next_token();
+///     co_yield sus::move(p);
+///   }
+/// };
+///
+/// auto count_items = [](AsyncGenerator<Page> pages) -> AsyncTask<usize> {
+///   usize count;
+///   for (Option<Page> p = co_await pages.next(); p.is_some();
+///        p = co_await pages.next()) {
+///     count += p->items.len();
+///   }
+///   co_return count;
+/// };
+/// ```
+///
+/// The combinators [`map`]($sus::iter::AsyncGenerator::map),
+/// [`filter`]($sus::iter::AsyncGenerator::filter),
+/// [`take`]($sus::iter::AsyncGenerator::take) and
+/// [`buffered`]($sus::iter::AsyncGenerator::buffered) consume the generator
+/// and produce another `AsyncGenerator`.
+template <class T>
+class [[nodiscard]] [[_sus_trivial_abi]] AsyncGenerator final {
+  static_assert(!std::is_reference_v<T>);
+
+ public:
+  // Coroutine implementation.
+  using promise_type = __private::AsyncIterPromise<T>;
+
+  using Item = T;
+
+  ~AsyncGenerator() noexcept {
+    if (co_handle_ != nullptr) co_handle_.destroy();
+  }
+
+  /// sus::mem::Move trait.
+  AsyncGenerator(AsyncGenerator&& o) noexcept
+      : co_handle_(::sus::mem::replace(o.co_handle_, nullptr)) {
+    sus_check(co_handle_ != nullptr);
+  }
+  /// sus::mem::Move trait.
+  AsyncGenerator& operator=(AsyncGenerator&& o) noexcept {
+    if (co_handle_ != nullptr) co_handle_.destroy();
+    co_handle_ = ::sus::mem::replace(o.co_handle_, nullptr);
+    sus_check(co_handle_ != nullptr);
+    return *this;
+  }
+
+  /// sus::iter::AsyncIterator trait.
+  ///
+  /// Returns an awaitable which runs the generator until it yields its next
+  /// item, and produces the item, or `None` once the generator has returned.
+  __private::AsyncNext<T> next() & noexcept {
+    return __private::AsyncNext<T>(co_handle_);
+  }
+
+  /// Produces an `AsyncGenerator` that calls `fn` on each item and yields its
+  /// result.
+  template <::sus::fn::FnMut<::sus::fn::NonVoid(T&&)> MapFn, int&...,
+            class R = std::invoke_result_t<MapFn&, T&&>>
+  AsyncGenerator<R> map(MapFn fn) && noexcept {
+    return map_impl<R>(::sus::move(*this), ::sus::move(fn));
+  }
+
+  /// Produces an `AsyncGenerator` that yields only the items for which `pred`
+  /// returns true.
+  template <::sus::fn::FnMut<bool(const std::remove_reference_t<T>&)> Pred>
+  AsyncGenerator filter(Pred pred) && noexcept {
+    return filter_impl(::sus::move(*this), ::sus::move(pred));
+  }
+
+  /// Produces an `AsyncGenerator` that yields the first `n` items, or fewer if
+  /// there are not that many.
+  AsyncGenerator take(usize n) && noexcept {
+    return take_impl(::sus::move(*this), n);
+  }
+
+  /// Produces an `AsyncGenerator` over the results of a generator of
+  /// [`AsyncTask`]($sus::iter::AsyncTask)s, which runs up to `n` of the tasks
+  /// at a time.
+  ///
+  /// Tasks start when they are created, so up to `n` tasks are received from
+  /// this generator ahead of the one whose result is yielded next. The results
+  /// are yielded in the same order as the tasks.
+  ///
+  /// # Panics
+  /// Panics if `n` is zero.
+  template <int&..., class Task = T>
+    requires(__private::IsAsyncTask<Task>::value)
+  AsyncGenerator<typename Task::Output> buffered(usize n) && noexcept {
+    sus_check(n > 0u);
+    return buffered_impl<typename Task::Output>(::sus::move(*this), n);
+  }
+
+ private:
+  friend promise_type;
+
+  explicit AsyncGenerator(promise_type& p) noexcept
+      : co_handle_(std::coroutine_handle<promise_type>::from_promise(p)) {}
+
+  template <class R, class MapFn>
+  static AsyncGenerator<R> map_impl(AsyncGenerator self, MapFn fn) noexcept {
+    for (Option<T> o = co_await self.next(); o.is_some();
+         o = co_await self.next()) {
+      co_yield ::sus::fn::call_mut(
+          fn, ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
+  }
+
+  template <class Pred>
+  static AsyncGenerator filter_impl(AsyncGenerator self, Pred pred) noexcept {
+    for (Option<T> o = co_await self.next(); o.is_some();
+         o = co_await self.next()) {
+      if (::sus::fn::call_mut(pred, o.as_value()))
+        co_yield ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn);
+    }
+  }
+
+  static AsyncGenerator take_impl(AsyncGenerator self, usize n) noexcept {
+    for (; n > 0u; n -= 1u) {
+      Option<T> o = co_await self.next();
+      if (o.is_none()) break;
+      co_yield ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn);
+    }
+  }
+
+  template <class R>
+  static AsyncGenerator<R> buffered_impl(AsyncGenerator self,
+                                         usize n) noexcept {
+    // A ring buffer of the running tasks, in the order they were received.
+    auto running = ::sus::collections::Vec<Option<T>>::with_capacity(n);
+    for (usize i; i < n; i += 1u) running.push(Option<T>());
+    usize front;
+    usize len;
+    bool more = true;
+    while (true) {
+      while (more && len < n) {
+        Option<T> task = co_await self.next();
+        if (task.is_none()) {
+          more = false;
+        } else {
+          running[(front + len) % n] = ::sus::move(task);
+          len += 1u;
+        }
+      }
+      if (len == 0u) break;
+      T task = running[front].take().unwrap_unchecked(::sus::marker::unsafe_fn);
+      front = (front + 1u) % n;
+      len -= 1u;
+      co_yield co_await ::sus::move(task);
+    }
+  }
+
+  std::coroutine_handle<promise_type> co_handle_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(co_handle_));
+};
+
+}  // namespace sus::iter
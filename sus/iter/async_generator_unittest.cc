@@ -0,0 +1,345 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/iter/async_generator.h"
+
+#include <string.h>
+
+#include <coroutine>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SUS_TEST_PIPES 1
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using sus::iter::AsyncGenerator;
+using sus::iter::AsyncTask;
+using sus::test::ensure_use;
+
+static_assert(sus::iter::AsyncIterator<AsyncGenerator<i32>, i32>);
+static_assert(!sus::iter::AsyncIterator<AsyncGenerator<i32>, u32>);
+static_assert(!sus::iter::AsyncIterator<sus::Vec<i32>, i32>);
+
+/// A single-threaded executor for tests. Coroutines wait on a simulated clock
+/// with `sleep()`, or for a pipe to be readable with `readable()`.
+class TestExecutor {
+ public:
+  /// Suspends the awaiting coroutine until the clock has advanced by `ticks`.
+  auto sleep(u64 ticks) noexcept {
+    struct Awaiter {
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> h) noexcept {
+        ex.sleeping_.push(Waiter(wake, h));
+      }
+      void await_resume() const noexcept {}
+      TestExecutor& ex;
+      u64 wake;
+    };
+    return Awaiter(*this, now_ + ticks);
+  }
+
+#if SUS_TEST_PIPES
+  /// Suspends the awaiting coroutine until `fd` has data to read.
+  auto readable(int fd) noexcept {
+    struct Awaiter {
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> h) noexcept {
+        ex.reading_.push(Waiter(u64::try_from(fd).unwrap(), h));
+      }
+      void await_resume() const noexcept {}
+      TestExecutor& ex;
+      int fd;
+    };
+    return Awaiter(*this, fd);
+  }
+#endif
+
+  /// Runs the coroutines that `task` is waiting on until it is done, and
+  /// returns its result. If the task can never be done, the test fails and a
+  /// default `T` is returned.
+  template <class T>
+  T run(AsyncTask<T> task) noexcept {
+    while (!task.is_done()) {
+#if SUS_TEST_PIPES
+      if (!reading_.is_empty()) {
+        auto fds = sus::Vec<pollfd>();
+        for (const Waiter& w : reading_) {
+          int fd = static_cast<int>(w.key.primitive_value);
+          fds.push(pollfd(fd, POLLIN, 0));
+        }
+        // Only block on the pipes if nothing else can happen.
+        int timeout = sleeping_.is_empty() ? -1 : 0;
+        EXPECT_GE(poll(fds.as_mut_ptr(), fds.len(), timeout), 0);
+        bool resumed = false;
+        for (usize i = fds.len(); i > 0u; i -= 1u) {
+          if (fds[i - 1u].revents != 0) {
+            swap_remove(reading_, i - 1u).handle.resume();
+            resumed = true;
+            break;
+          }
+        }
+        if (resumed) continue;
+      }
+#endif
+      // Nothing can run until the clock advances to the next sleeper. If there
+      // is none, the task can never finish, so the test fails without running
+      // any further.
+      if (sleeping_.is_empty()) {
+        ADD_FAILURE() << "The task is waiting, but nothing can wake it";
+        return T();
+      }
+      usize next;
+      for (usize i = 1u; i < sleeping_.len(); i += 1u) {
+        if (sleeping_[i].key < sleeping_[next].key) next = i;
+      }
+      Waiter w = swap_remove(sleeping_, next);
+      now_ = w.key;
+      w.handle.resume();
+    }
+    return sus::move(task).unwrap();
+  }
+
+  /// The current time on the simulated clock.
+  u64 now() const noexcept { return now_; }
+
+ private:
+  struct Waiter {
+    // The wake time, or the file descriptor.
+    u64 key;
+    std::coroutine_handle<> handle;
+  };
+
+  static Waiter swap_remove(sus::Vec<Waiter>& v, usize i) noexcept {
+    Waiter w = v[i];
+    v[i] = v[v.len() - 1u];
+    v.pop();
+    return w;
+  }
+
+  u64 now_;
+  sus::Vec<Waiter> sleeping_;
+  sus::Vec<Waiter> reading_;
+};
+
+AsyncGenerator<i32> slow_count(TestExecutor& ex, i32 n) {
+  for (i32 i; i < n; i += 1) {
+    co_await ex.sleep(10u);
+    co_yield i;
+  }
+}
+
+AsyncTask<sus::Vec<i32>> collect(AsyncGenerator<i32> gen) {
+  auto v = sus::Vec<i32>();
+  for (Option<i32> o = co_await gen.next(); o.is_some();
+       o = co_await gen.next()) {
+    v.push(*o);
+  }
+  co_return v;
+}
+
+TEST(AsyncGenerator, Next) {
+  auto ex = TestExecutor();
+  auto gen = slow_count(ex, 3);
+  auto task = [](AsyncGenerator<i32>& gen) -> AsyncTask<i32> {
+    i32 sum;
+    for (Option<i32> o = co_await gen.next(); o.is_some();
+         o = co_await gen.next()) {
+      sum += *o;
+    }
+    // The generator is done, and keeps returning None.
+    EXPECT_EQ(co_await gen.next(), sus::None);
+    co_return sum;
+  }(gen);
+  // The generator does not run until it is awaited.
+  EXPECT_FALSE(task.is_done());
+  EXPECT_EQ(ex.run(sus::move(task)), 0 + 1 + 2);
+  EXPECT_EQ(ex.now(), 30u);
+}
+
+TEST(AsyncGenerator, Empty) {
+  auto ex = TestExecutor();
+  auto task = collect([]() -> AsyncGenerator<i32> { co_return; }());
+  // Nothing is awaited so the task finishes right away.
+  EXPECT_TRUE(task.is_done());
+  EXPECT_EQ(ex.run(sus::move(task)), sus::Vec<i32>());
+}
+
+TEST(AsyncGenerator, Map) {
+  auto ex = TestExecutor();
+  auto gen = slow_count(ex, 4).map([](i32 i) { return i * 10; });
+  EXPECT_EQ(ex.run(collect(sus::move(gen))), sus::Vec<i32>(0, 10, 20, 30));
+
+  // Map to another type.
+  auto task = [](AsyncGenerator<u32> gen) -> AsyncTask<u32> {
+    u32 sum;
+    for (Option<u32> o = co_await gen.next(); o.is_some();
+         o = co_await gen.next()) {
+      sum += *o;
+    }
+    co_return sum;
+  }(slow_count(ex, 4).map([](i32 i) { return u32::try_from(i).unwrap(); }));
+  EXPECT_EQ(ex.run(sus::move(task)), 0u + 1u + 2u + 3u);
+}
+
+TEST(AsyncGenerator, Filter) {
+  auto ex = TestExecutor();
+  auto gen = slow_count(ex, 6).filter([](const i32& i) { return i % 2 == 1; });
+  EXPECT_EQ(ex.run(collect(sus::move(gen))), sus::Vec<i32>(1, 3, 5));
+}
+
+TEST(AsyncGenerator, Take) {
+  auto ex = TestExecutor();
+  EXPECT_EQ(ex.run(collect(slow_count(ex, 10).take(3u))),
+            sus::Vec<i32>(0, 1, 2));
+  // The generator is not resumed after the last item taken.
+  EXPECT_EQ(ex.now(), 30u);
+
+  EXPECT_EQ(ex.run(collect(slow_count(ex, 2).take(3u))), sus::Vec<i32>(0, 1));
+  EXPECT_EQ(ex.run(collect(slow_count(ex, 2).take(0u))), sus::Vec<i32>());
+}
+
+TEST(AsyncGenerator, Chained) {
+  auto ex = TestExecutor();
+  auto gen = slow_count(ex, 100)
+                 .filter([](const i32& i) { return i % 3 == 0; })
+                 .map([](i32 i) { return i + 1; })
+                 .take(4u);
+  EXPECT_EQ(ex.run(collect(sus::move(gen))), sus::Vec<i32>(1, 4, 7, 10));
+}
+
+AsyncTask<i32> fetch(TestExecutor& ex, i32 page, u64 latency) {
+  co_await ex.sleep(latency);
+  co_return page * 100;
+}
+
+AsyncGenerator<AsyncTask<i32>> fetch_pages(TestExecutor& ex, i32 n) {
+  for (i32 i; i < n; i += 1) {
+    // Later pages are faster, but results are still in order.
+    co_yield fetch(ex, i, u64::try_from(10 * (n - i)).unwrap());
+  }
+}
+
+TEST(AsyncGenerator, Buffered) {
+  // One at a time, the latencies add up.
+  {
+    auto ex = TestExecutor();
+    auto gen = fetch_pages(ex, 4).buffered(1u);
+    EXPECT_EQ(ex.run(collect(sus::move(gen))),
+              sus::Vec<i32>(0, 100, 200, 300));
+    EXPECT_EQ(ex.now(), 40u + 30u + 20u + 10u);
+  }
+  // All at once, the slowest one dominates.
+  {
+    auto ex = TestExecutor();
+    auto gen = fetch_pages(ex, 4).buffered(4u);
+    EXPECT_EQ(ex.run(collect(sus::move(gen))),
+              sus::Vec<i32>(0, 100, 200, 300));
+    EXPECT_EQ(ex.now(), 40u);
+  }
+  // Two at a time: pages 0 and 1 start at 0, page 2 starts when page 0 is
+  // done at 40, page 3 starts when page 1 is done (also at 40 as it was
+  // already done).
+  {
+    auto ex = TestExecutor();
+    auto gen = fetch_pages(ex, 4).buffered(2u);
+    EXPECT_EQ(ex.run(collect(sus::move(gen))),
+              sus::Vec<i32>(0, 100, 200, 300));
+    EXPECT_EQ(ex.now(), 40u + 20u);
+  }
+  // More room than tasks.
+  {
+    auto ex = TestExecutor();
+    auto gen = fetch_pages(ex, 2).buffered(8u);
+    EXPECT_EQ(ex.run(collect(sus::move(gen))), sus::Vec<i32>(0, 100));
+    EXPECT_EQ(ex.now(), 20u);
+  }
+}
+
+TEST(AsyncGeneratorDeathTest, BufferedZero) {
+#if GTEST_HAS_DEATH_TEST
+  auto ex = TestExecutor();
+  EXPECT_DEATH(
+      {
+        auto gen = fetch_pages(ex, 1).buffered(0u);
+        ensure_use(&gen);
+      },
+      "");
+#endif
+}
+
+TEST(AsyncTask, Await) {
+  auto ex = TestExecutor();
+  auto outer = [](TestExecutor& ex) -> AsyncTask<i32> {
+    AsyncTask<i32> a = fetch(ex, 1, 20u);
+    AsyncTask<i32> b = fetch(ex, 2, 10u);
+    // Both are running, and `b` finishes first.
+    i32 r = co_await sus::move(a);
+    EXPECT_TRUE(b.is_done());
+    co_return r + co_await sus::move(b);
+  }(ex);
+  EXPECT_EQ(ex.run(sus::move(outer)), 300);
+  EXPECT_EQ(ex.now(), 20u);
+}
+
+#if SUS_TEST_PIPES
+AsyncGenerator<char> read_pipe(TestExecutor& ex, int fd) {
+  while (true) {
+    co_await ex.readable(fd);
+    char buf[4];
+    ssize_t n = ::read(fd, buf, sizeof(buf));
+    if (n <= 0) co_return;  // Closed.
+    for (ssize_t i = 0; i < n; ++i) co_yield buf[i];
+  }
+}
+
+AsyncTask<i32> write_pipe(TestExecutor& ex, int fd) {
+  for (const char* s : {"hello", " ", "pipe"}) {
+    co_await ex.sleep(5u);
+    EXPECT_GT(::write(fd, s, strlen(s)), 0);
+  }
+  ::close(fd);
+  co_return 0;
+}
+
+TEST(AsyncGenerator, Pipe) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+  auto ex = TestExecutor();
+
+  auto reader = [](AsyncGenerator<char> gen) -> AsyncTask<sus::Vec<char>> {
+    auto v = sus::Vec<char>();
+    for (Option<char> o = co_await gen.next(); o.is_some();
+         o = co_await gen.next()) {
+      v.push(*o);
+    }
+    co_return v;
+  }(read_pipe(ex, fds[0]).filter([](const char& c) { return c != ' '; }));
+  AsyncTask<i32> writer = write_pipe(ex, fds[1]);
+
+  sus::Vec<char> v = ex.run(sus::move(reader));
+  EXPECT_EQ(v, sus::Vec<char>('h', 'e', 'l', 'l', 'o', 'p', 'i', 'p', 'e'));
+  EXPECT_TRUE(writer.is_done());
+  ::close(fds[0]);
+}
+#endif
+
+}  // namespace
@@ -0,0 +1,300 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/collections/array.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_concept.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/addressof.h"
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+#include "sus/result/result.h"
+
+namespace sus::iter {
+
+/// A type-erased iterator over `ItemT`, which can hold any
+/// [`Iterator`]($sus::iter::Iterator) over the same `ItemT`.
+///
+/// The adaptor types produced by chaining iterator methods are large and
+/// deeply nested templates, which forces every function that receives one to
+/// be a template as well. `DynIterator` erases the type of the iterator it
+/// holds, so that it can be passed across API boundaries, stored in class
+/// members, or returned from virtual methods without templates.
+///
+/// Unlike a `Box<T>`, a `DynIterator` holds its iterator inline when it fits
+/// in `InlineBytes`, in which case it does not allocate. Larger iterators are
+/// moved to the heap. Each call to [`next`]($sus::iter::DynIterator::next) is
+/// an indirect call into the erased iterator, but
+/// [`fold`]($sus::iter::DynIterator::fold), and the methods built on it such as
+/// [`for_each`]($sus::iter::IteratorBase::for_each) and
+/// [`sum`]($sus::iter::IteratorBase::sum), pull elements across the type
+/// erasure a chunk at a time, so the erased iterator's `next()` is called
+/// directly in a loop and the indirect call is made once per chunk. Likewise
+/// [`next_chunk`]($sus::iter::DynIterator::next_chunk) fills its whole array
+/// with a single indirect call.
+///
+/// The [`size_hint`]($sus::iter::DynIterator::size_hint) of the erased
+/// iterator is passed through, so collecting from a `DynIterator` can reserve
+/// space the same as the iterator it holds.
+///
+/// A `DynIterator` owns the iterator it holds. To iterate through a
+/// type-erased iterator without taking ownership of it, hold the iterator
+/// returned from [`by_ref`]($sus::iter::IteratorBase::by_ref), which is
+/// only valid for the scope of the original iterator.
+///
+/// A moved-from `DynIterator` may not be used except to be assigned to or
+/// destroyed. Using a moved-from `DynIterator` will [`panic`]($sus_panic).
+///
+/// # Examples
+/// ```
+/// // Not a template, and the `Map` type does not appear in the signature.
+/// auto doubled = [](sus::iter::DynIterator<i32> it) {
+///   return sus::move(it).map([](i32 i) { return i * 2; }).collect_vec();
+/// };
+/// auto v = sus::Vec<i32>(1, 2, 3);
+/// auto it = sus::iter::DynIterator<i32>::from(
+///     sus::move(v).into_iter().filter([](const i32& i) { return i != 2; }));
+/// sus_check(doubled(sus::move(it)) == sus::Vec<i32>(2, 6));
+/// ```
+template <class ItemT, size_t InlineBytes = 6u * sizeof(void*)>
+class [[nodiscard]] DynIterator final
+    : public IteratorBase<DynIterator<ItemT, InlineBytes>, ItemT> {
+  // The number of elements pulled across the type erasure at a time.
+  static constexpr size_t ChunkLen = 32u;
+  using Chunk = ::sus::collections::Array<Option<ItemT>, ChunkLen>;
+
+  template <class Iter>
+  static constexpr bool FitsInline =
+      sizeof(Iter) <= InlineBytes &&
+      alignof(Iter) <= alignof(std::max_align_t) &&
+      std::is_nothrow_move_constructible_v<Iter>;
+
+ public:
+  using Item = ItemT;
+
+  /// Type-erases an iterator, moving it into the `DynIterator`.
+  ///
+  /// The iterator is held inline if it fits in `InlineBytes`, and is
+  /// moved to the heap otherwise.
+  ///
+  /// #[doc.implements=sus::construct::From]
+  template <class Iter>
+    requires(::sus::iter::Iterator<Iter, ItemT> &&  //
+             !std::is_reference_v<Iter> &&          //
+             !std::same_as<Iter, DynIterator>)
+  static DynIterator from(Iter&& iter) noexcept {
+    return DynIterator(::sus::move(iter));
+  }
+
+  /// Whether an iterator of type `Iter` will be held inline, without a heap
+  /// allocation.
+  template <class Iter>
+  static constexpr bool holds_inline() noexcept {
+    return FitsInline<Iter>;
+  }
+
+  /// Destroys the iterator held in the `DynIterator`.
+  ///
+  /// Does nothing if the `DynIterator` was moved-from.
+  ~DynIterator() noexcept {
+    if (vtable_ != nullptr) vtable_->destroy(storage_);
+  }
+
+  // Type is Move.
+  DynIterator(DynIterator&& o) noexcept
+      : vtable_(::sus::mem::replace(o.vtable_, nullptr)) {
+    if (vtable_ != nullptr) vtable_->relocate(storage_, o.storage_);
+  }
+  DynIterator& operator=(DynIterator&& o) noexcept {
+    if (this != &o) {
+      if (vtable_ != nullptr) vtable_->destroy(storage_);
+      vtable_ = ::sus::mem::replace(o.vtable_, nullptr);
+      if (vtable_ != nullptr) vtable_->relocate(storage_, o.storage_);
+    }
+    return *this;
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    sus_check_with_message(vtable_ != nullptr, "DynIterator used after move");
+    return vtable_->next(storage_);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the size hint of the type-erased iterator.
+  SizeHint size_hint() const noexcept {
+    sus_check_with_message(vtable_ != nullptr, "DynIterator used after move");
+    return vtable_->size_hint(storage_);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Pulls the next `N` elements from the type-erased iterator with a single
+  /// indirect call, rather than calling `next()` through the type erasure for
+  /// each element.
+  template <size_t N>
+    requires(!std::is_reference_v<Item>)
+  ::sus::result::Result<::sus::collections::Array<Item, N>,
+                        ::sus::collections::Array<Option<Item>, N>>
+  next_chunk() noexcept {
+    using Full = ::sus::collections::Array<Item, N>;
+    using Partial = ::sus::collections::Array<Option<Item>, N>;
+    using Out = ::sus::result::Result<Full, Partial>;
+    sus_check_with_message(vtable_ != nullptr, "DynIterator used after move");
+    Partial partial;
+    const usize len = vtable_->fill(storage_, partial.as_mut_ptr(), N);
+    if (len < N) return Out::with_err(::sus::move(partial));
+    return Out(Full::with_initializer(
+        [&partial, i = 0_usize]() mutable {
+          return take(partial, ::sus::mem::replace(i, i + 1u));
+        }));
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Pulls elements from the type-erased iterator a chunk at a time, making
+  /// a single indirect call for each chunk.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+  B fold(B init, F f) && noexcept {
+    sus_check_with_message(vtable_ != nullptr, "DynIterator used after move");
+    Chunk chunk;
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      while (true) {
+        const usize len = vtable_->fill(storage_, chunk.as_mut_ptr(), ChunkLen);
+        for (usize i; i < len; i += 1u) {
+          out = ::sus::mem::addressof(
+              ::sus::fn::call_mut(f, *out, take(chunk, i)));
+        }
+        if (len < ChunkLen) return *out;
+      }
+    } else {
+      while (true) {
+        const usize len = vtable_->fill(storage_, chunk.as_mut_ptr(), ChunkLen);
+        for (usize i; i < len; i += 1u)
+          init = ::sus::fn::call_mut(f, ::sus::move(init), take(chunk, i));
+        if (len < ChunkLen) return init;
+      }
+    }
+  }
+
+ private:
+  // Function pointers that operate on the iterator held in `storage_`, which
+  // are generated for each type of iterator that is erased.
+  struct VTable {
+    Option<Item> (*next)(void* storage) noexcept;
+    SizeHint (*size_hint)(const void* storage) noexcept;
+    // Fills up to `n` elements of `out` from the front with elements from the
+    // iterator, and returns how many were written. Fewer than `n` are written
+    // only once the iterator is exhausted.
+    usize (*fill)(void* storage, Option<Item>* out, usize n) noexcept;
+    // Moves the iterator from `src` to `dst`, leaving `src` uninitialized.
+    void (*relocate)(void* dst, void* src) noexcept;
+    void (*destroy)(void* storage) noexcept;
+  };
+
+  template <class Iter>
+  struct Erased {
+    static Iter& get(void* storage) noexcept {
+      if constexpr (FitsInline<Iter>)
+        return *std::launder(reinterpret_cast<Iter*>(storage));
+      else
+        return **reinterpret_cast<Iter**>(storage);
+    }
+    static const Iter& get(const void* storage) noexcept {
+      if constexpr (FitsInline<Iter>)
+        return *std::launder(reinterpret_cast<const Iter*>(storage));
+      else
+        return **reinterpret_cast<Iter* const*>(storage);
+    }
+
+    static Option<Item> next(void* storage) noexcept {
+      return get(storage).next();
+    }
+    static SizeHint size_hint(const void* storage) noexcept {
+      return get(storage).size_hint();
+    }
+    static usize fill(void* storage, Option<Item>* out, usize n) noexcept {
+      if (n == 0u) return 0u;
+      // Fills the output through `try_fold()`, which iterators can implement
+      // with a tighter loop than calling `next()` for each element. It stops
+      // with `None` once `n` elements are written.
+      Option<usize> filled = get(storage).try_fold(
+          0_usize, [out, n](usize len, Item&& item) -> Option<usize> {
+            out[size_t{len}] = Option<Item>(::sus::forward<Item>(item));
+            len += 1u;
+            if (len == n) return Option<usize>();
+            return Option<usize>(len);
+          });
+      return ::sus::move(filled).unwrap_or(n);
+    }
+    static void relocate(void* dst, void* src) noexcept {
+      if constexpr (FitsInline<Iter>) {
+        Iter& from = get(src);
+        new (dst) Iter(::sus::move(from));
+        from.~Iter();
+      } else {
+        *reinterpret_cast<Iter**>(dst) = *reinterpret_cast<Iter**>(src);
+      }
+    }
+    static void destroy(void* storage) noexcept {
+      if constexpr (FitsInline<Iter>)
+        get(storage).~Iter();
+      else
+        delete *reinterpret_cast<Iter**>(storage);
+    }
+
+    static constexpr VTable vtable = {&next, &size_hint, &fill, &relocate,
+                                      &destroy};
+  };
+
+  template <class Iter>
+  explicit DynIterator(Iter&& iter) noexcept : vtable_(&Erased<Iter>::vtable) {
+    if constexpr (FitsInline<Iter>)
+      new (storage_) Iter(::sus::move(iter));
+    else
+      *reinterpret_cast<Iter**>(storage_) = new Iter(::sus::move(iter));
+  }
+
+  template <size_t N>
+  static Item take(::sus::collections::Array<Option<Item>, N>& chunk,
+                   usize i) noexcept {
+    // SAFETY: The first `len` elements of the chunk were filled with values by
+    // `fill()`, and `i < len`.
+    return chunk.get_unchecked_mut(::sus::marker::unsafe_fn, i)
+        .take()
+        .unwrap_unchecked(::sus::marker::unsafe_fn);
+  }
+
+  // Null once the `DynIterator` is moved-from.
+  const VTable* vtable_;
+  // Holds the iterator if it fits inline, or a pointer to it on the heap.
+  alignas(std::max_align_t) unsigned char storage_[
+      InlineBytes < sizeof(void*) ? sizeof(void*) : InlineBytes];
+};
+
+}  // namespace sus::iter
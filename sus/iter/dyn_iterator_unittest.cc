@@ -0,0 +1,242 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/iter/dyn_iterator.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/array.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::iter::DynIterator;
+
+static_assert(sus::iter::Iterator<DynIterator<i32>, i32>);
+static_assert(sus::iter::Iterator<DynIterator<const i32&>, const i32&>);
+static_assert(!sus::iter::DoubleEndedIterator<DynIterator<i32>, i32>);
+static_assert(std::is_nothrow_move_constructible_v<DynIterator<i32>>);
+static_assert(std::is_nothrow_move_assignable_v<DynIterator<i32>>);
+static_assert(!std::is_copy_constructible_v<DynIterator<i32>>);
+static_assert(sus::construct::From<DynIterator<i32>,
+                                   sus::collections::VecIntoIter<i32>>);
+
+// Small iterators are held inline, and larger ones on the heap.
+static_assert(
+    DynIterator<i32>::holds_inline<sus::collections::VecIntoIter<i32>>());
+static_assert(DynIterator<const i32&>::holds_inline<
+              sus::collections::SliceIter<const i32&>>());
+static_assert(!DynIterator<const i32&, 0u>::holds_inline<
+              sus::collections::SliceIter<const i32&>>());
+
+// A function at an API boundary, which receives any iterator over `i32`.
+i32 sum_all(DynIterator<i32> it) { return sus::move(it).sum(); }
+
+// An iterator that counts how many times it is destroyed without having been
+// moved from.
+struct Counted final : public sus::iter::IteratorBase<Counted, i32> {
+  using Item = i32;
+
+  Counted(i32 n, i32& drops) : n(n), drops(&drops) {}
+  Counted(Counted&& o) noexcept
+      : n(o.n), drops(sus::mem::replace(o.drops, nullptr)) {}
+  Counted& operator=(Counted&& o) noexcept {
+    n = o.n;
+    drops = sus::mem::replace(o.drops, nullptr);
+    return *this;
+  }
+  ~Counted() {
+    if (drops) *drops += 1;
+  }
+
+  sus::Option<i32> next() noexcept {
+    if (n == 0) return sus::none();
+    n -= 1;
+    return sus::some(n);
+  }
+  sus::iter::SizeHint size_hint() const noexcept {
+    return sus::iter::SizeHint(usize::try_from(n).unwrap(),
+                               sus::some(usize::try_from(n).unwrap()));
+  }
+
+  i32 n;
+  i32* drops;
+};
+
+TEST(DynIterator, Example) {
+  auto doubled = [](sus::iter::DynIterator<i32> it) {
+    return sus::move(it).map([](i32 i) { return i * 2; }).collect_vec();
+  };
+  auto v = sus::Vec<i32>(1, 2, 3);
+  auto it = sus::iter::DynIterator<i32>::from(
+      sus::move(v).into_iter().filter([](const i32& i) { return i != 2; }));
+  sus_check(doubled(sus::move(it)) == sus::Vec<i32>(2, 6));
+}
+
+TEST(DynIterator, Next) {
+  auto v = sus::Vec<i32>(1, 2, 3);
+  auto it = DynIterator<i32>::from(sus::move(v).into_iter());
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
+  EXPECT_EQ(it.next(), sus::some(1));
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
+  EXPECT_EQ(it.next(), sus::some(2));
+  EXPECT_EQ(it.next(), sus::some(3));
+  EXPECT_EQ(it.next(), sus::none());
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+
+  // Through a non-template function.
+  auto a = sus::Array<i32, 3>(1, 2, 3);
+  EXPECT_EQ(sum_all(sus::into(a.iter().copied())), 6);
+  EXPECT_EQ(sum_all(sus::into(sus::move(a).into_iter().map(
+                [](i32 i) { return i * 10; }))),
+            60);
+}
+
+TEST(DynIterator, Reference) {
+  auto v = sus::Vec<i32>(1, 2, 3);
+  auto it = DynIterator<const i32&>::from(v.iter());
+  const i32& first = it.next().unwrap();
+  EXPECT_EQ(&first, &v[0u]);
+  EXPECT_EQ(sus::move(it).copied().collect_vec(), sus::Vec<i32>(2, 3));
+}
+
+TEST(DynIterator, Heap) {
+  auto v = sus::Vec<i32>(1, 2, 3);
+  // Nothing fits in zero bytes, so the iterator is moved to the heap.
+  auto it = DynIterator<i32, 0u>::from(sus::move(v).into_iter());
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
+  EXPECT_EQ(it.next(), sus::some(1));
+  auto moved = sus::move(it);
+  EXPECT_EQ(moved.next(), sus::some(2));
+  EXPECT_EQ(sus::move(moved).sum(), 3);
+}
+
+TEST(DynIterator, Move) {
+  i32 drops;
+  {
+    auto it = DynIterator<i32>::from(Counted(3, drops));
+    EXPECT_EQ(it.next(), sus::some(2));
+    auto moved = sus::move(it);
+    EXPECT_EQ(drops, 0);
+    EXPECT_EQ(moved.next(), sus::some(1));
+
+    auto other = DynIterator<i32>::from(Counted(5, drops));
+    other = sus::move(moved);
+    // The iterator that was held in `other` is destroyed.
+    EXPECT_EQ(drops, 1);
+    EXPECT_EQ(other.next(), sus::some(0));
+    EXPECT_EQ(other.next(), sus::none());
+  }
+  EXPECT_EQ(drops, 2);
+
+  drops = 0;
+  {
+    auto it = DynIterator<i32, 0u>::from(Counted(3, drops));
+    auto moved = sus::move(it);
+    EXPECT_EQ(moved.next(), sus::some(2));
+    auto other = DynIterator<i32, 0u>::from(Counted(5, drops));
+    other = sus::move(moved);
+    EXPECT_EQ(drops, 1);
+    EXPECT_EQ(other.next(), sus::some(1));
+  }
+  EXPECT_EQ(drops, 2);
+}
+
+TEST(DynIterator, Fold) {
+  // Crosses the boundaries of the chunks which are pulled through the type
+  // erasure.
+  for (usize len : sus::Vec<usize>(0u, 1u, 31u, 32u, 33u, 64u, 100u)) {
+    auto v = sus::Vec<usize>::with_capacity(len);
+    for (usize i; i < len; i += 1u) v.push(i);
+    usize expected;
+    for (usize i : v.iter()) expected += i;
+
+    EXPECT_EQ(DynIterator<usize>::from(v.clone().into_iter()).sum(), expected);
+    EXPECT_EQ(DynIterator<const usize&>::from(v.iter()).count(), len);
+
+    auto collected = sus::Vec<usize>();
+    DynIterator<usize>::from(v.clone().into_iter()).for_each([&](usize i) {
+      collected.push(i);
+    });
+    EXPECT_EQ(collected, v);
+  }
+
+  // Fold with a reference.
+  auto v = sus::Vec<i32>(1, 2, 3);
+  i32 total;
+  i32& out = DynIterator<i32>::from(sus::move(v).into_iter())
+                 .fold<i32&>(total, [](i32& acc, i32 i) -> i32& {
+                   acc += i;
+                   return acc;
+                 });
+  EXPECT_EQ(&out, &total);
+  EXPECT_EQ(total, 6);
+}
+
+TEST(DynIterator, NextChunk) {
+  i32 drops;
+  auto it = DynIterator<i32>::from(Counted(5, drops));
+  EXPECT_EQ(it.next_chunk<2>().unwrap(), (sus::Array<i32, 2>(4, 3)));
+  EXPECT_EQ(it.next_chunk<2>().unwrap(), (sus::Array<i32, 2>(2, 1)));
+  auto partial = it.next_chunk<2>().unwrap_err();
+  EXPECT_EQ(partial[0u], sus::some(0));
+  EXPECT_EQ(partial[1u], sus::none());
+  EXPECT_EQ(it.next(), sus::none());
+
+  // Chunks larger than those pulled through the type erasure by `fold()`.
+  auto v = sus::Vec<i32>();
+  for (i32 i; i < 100; i += 1) v.push(i);
+  auto big = DynIterator<i32>::from(sus::move(v).into_iter());
+  auto chunk = big.next_chunk<64>().unwrap();
+  EXPECT_EQ(chunk[0u], 0);
+  EXPECT_EQ(chunk[63u], 63);
+  EXPECT_EQ(big.next().unwrap(), 64);
+  EXPECT_EQ(sus::move(big).count(), 35u);
+}
+
+TEST(DynIterator, SizeHintReserves) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4, 5);
+  auto it = DynIterator<i32>::from(sus::move(v).into_iter());
+  auto collected = sus::move(it).collect_vec();
+  EXPECT_EQ(collected.capacity(), 5u);
+}
+
+TEST(DynIterator, ByRef) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4);
+  auto it = sus::move(v).into_iter();
+  {
+    // Type-erase the iterator without taking ownership of it.
+    auto dyn = DynIterator<i32>::from(it.by_ref().take(2u));
+    EXPECT_EQ(sus::move(dyn).sum(), 1 + 2);
+  }
+  EXPECT_EQ(it.next(), sus::some(3));
+}
+
+TEST(DynIteratorDeathTest, UseAfterMove) {
+  auto it = DynIterator<i32>::from(sus::Vec<i32>(1).into_iter());
+  auto moved = sus::move(it);
+  sus::test::ensure_use(&moved);
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto o = it.next();
+        sus::test::ensure_use(&o);
+      },
+      "");
+#endif
+}
+
+}  // namespace
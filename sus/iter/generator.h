@@ -17,6 +17,7 @@
 #include <coroutine>
 
 #include "sus/assertions/unreachable.h"
+#include "sus/iter/__private/generator_frame.h"
 #include "sus/iter/__private/iterator_end.h"
 #include "sus/iter/__private/is_generator.h"
 #include "sus/iter/iterator_defn.h"
@@ -69,7 +70,7 @@ Iterator<typename R::Item> auto from_generator(F&& f) {
 namespace __private {
 
 template <class Generator, class T>
-class IterPromise {
+class IterPromise : public FrameAllocatingPromise {
  public:
   auto get_return_object() noexcept { return Generator(*this); }
 
@@ -185,6 +186,29 @@ class [[nodiscard]] [[_sus_trivial_abi]] GeneratorLoop {
 /// sus::Vec<i32> v2 = generate_fibonacci().take(7u).collect_vec();
 /// sus_check(v2 == sus::Vec<i32>(0, 1, 1, 2, 3, 5, 8));
 /// ```
+///
+/// # Frame allocation
+/// The state of each generator is held in a coroutine frame on the heap.
+/// Frames are allocated from a per-thread pool, so creating and destroying
+/// generators repeatedly on a thread reuses the same memory instead of going
+/// to the global heap each time.
+///
+/// To allocate the frame with an allocator, such as an arena, pass
+/// `std::allocator_arg` and the allocator as the first arguments of the
+/// generator function. The allocator is copied into the frame in order to free
+/// it.
+/// ```
+/// auto generate = [](std::allocator_arg_t, const Arena& a) -> Generator<i32> {
+///   co_yield 1;
+///   co_yield 2;
+/// };
+/// auto g = generate(std::allocator_arg, arena);
+/// ```
+///
+/// When a generator is created and fully consumed within a single function,
+/// and its functions are inlined, Clang can elide the heap allocation of the
+/// frame entirely and place it on the stack. This requires the `Generator` not
+/// to be moved or returned out of the function that creates it.
 template <class T>
 class [[nodiscard]] [[_sus_trivial_abi]] Generator final
     : public ::sus::iter::IteratorBase<Generator<T>, T> {
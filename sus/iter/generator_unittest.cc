@@ -160,4 +160,95 @@ TEST(IterGenerator, ComposeIntoGenerator) {
   EXPECT_EQ(it.next(), sus::None);
 }
 
+TEST(IterGenerator, ReuseFrames) {
+  auto x = [](i32 n) -> Generator<i32> {
+    for (i32 i; i < n; i += 1) co_yield i;
+  };
+  // Frames are returned to the thread's pool and reused. Generators can outlive
+  // each other in any order.
+  auto a = x(3);
+  for (i32 round; round < 100; round += 1) {
+    auto b = x(round);
+    EXPECT_EQ(sus::move(b).count(), usize::try_from(round).unwrap());
+  }
+  EXPECT_EQ(sus::move(a).sum(), 0 + 1 + 2);
+}
+
+// Counts the blocks allocated through it, and those not yet freed.
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator(usize& allocated, usize& live)
+      : allocated(allocated), live(live) {}
+  template <class U>
+  CountingAllocator(const CountingAllocator<U>& o)
+      : allocated(o.allocated), live(o.live) {}
+
+  T* allocate(size_t n) {
+    allocated += 1u;
+    live += 1u;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) {
+    live -= 1u;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  usize& allocated;
+  usize& live;
+};
+
+TEST(IterGenerator, Allocator) {
+  usize allocated, live;
+  auto alloc = CountingAllocator<char>(allocated, live);
+
+  auto x = [](std::allocator_arg_t, const CountingAllocator<char>&,
+              i32 n) -> Generator<i32> {
+    for (i32 i; i < n; i += 1) co_yield i;
+  };
+  {
+    auto it = x(std::allocator_arg, alloc, 4);
+    EXPECT_EQ(allocated, 1u);
+    EXPECT_EQ(live, 1u);
+    EXPECT_EQ(it.next().unwrap(), 0);
+    EXPECT_EQ(sus::move(it).sum(), 1 + 2 + 3);
+    // The frame is freed once the generator is destroyed.
+    EXPECT_EQ(live, 1u);
+  }
+  EXPECT_EQ(live, 0u);
+
+  // A generator that is not run still frees its frame.
+  { auto it = x(std::allocator_arg, alloc, 4); }
+  EXPECT_EQ(allocated, 2u);
+  EXPECT_EQ(live, 0u);
+
+  // Without the allocator, the frame comes from the thread's pool.
+  auto y = [](i32 n) -> Generator<i32> {
+    for (i32 i; i < n; i += 1) co_yield i;
+  };
+  EXPECT_EQ(y(4).sum(), 0 + 1 + 2 + 3);
+  EXPECT_EQ(allocated, 2u);
+}
+
+struct MemberGenerator {
+  Generator<i32> generate(std::allocator_arg_t,
+                          const CountingAllocator<char>&) const {
+    co_yield i;
+    co_yield i + 1;
+  }
+  i32 i;
+};
+
+TEST(IterGenerator, AllocatorMemberFunction) {
+  usize allocated, live;
+  auto alloc = CountingAllocator<char>(allocated, live);
+
+  auto m = MemberGenerator(5);
+  EXPECT_EQ(m.generate(std::allocator_arg, alloc).collect_vec(),
+            sus::Vec<i32>(5, 6));
+  EXPECT_EQ(allocated, 1u);
+  EXPECT_EQ(live, 0u);
+}
+
 }  // namespace
@@ -57,11 +57,16 @@ namespace iter {}
 // Headers that define iterators that Iterator can construct and return. They
 // are forward declared in iterator_defn.h so that transitive includes don't get
 // them all every time.
+#include "sus/iter/adaptors/array_chunks.h"
+#include "sus/iter/adaptors/batched.h"
 #include "sus/iter/adaptors/by_ref.h"
 #include "sus/iter/adaptors/chain.h"
+#include "sus/iter/adaptors/chunk_by.h"
 #include "sus/iter/adaptors/cloned.h"
 #include "sus/iter/adaptors/copied.h"
 #include "sus/iter/adaptors/cycle.h"
+#include "sus/iter/adaptors/dedup_by.h"
+#include "sus/iter/adaptors/dedup_by_key.h"
 #include "sus/iter/adaptors/enumerate.h"
 #include "sus/iter/adaptors/filter.h"
 #include "sus/iter/adaptors/filter_map.h"
@@ -69,13 +74,20 @@ namespace iter {}
 #include "sus/iter/adaptors/flatten.h"
 #include "sus/iter/adaptors/fuse.h"
 #include "sus/iter/adaptors/inspect.h"
+#include "sus/iter/adaptors/kmerge_by.h"
 #include "sus/iter/adaptors/map.h"
 #include "sus/iter/adaptors/map_while.h"
+#include "sus/iter/adaptors/merge_by.h"
+#include "sus/iter/adaptors/merge_join_by.h"
 #include "sus/iter/adaptors/peekable.h"
+#include "sus/iter/adaptors/prefetch.h"
 #include "sus/iter/adaptors/reverse.h"
 #include "sus/iter/adaptors/scan.h"
 #include "sus/iter/adaptors/skip.h"
 #include "sus/iter/adaptors/skip_while.h"
+#include "sus/iter/adaptors/sorted_difference.h"
+#include "sus/iter/adaptors/sorted_intersection.h"
+#include "sus/iter/adaptors/sorted_union.h"
 #include "sus/iter/adaptors/step_by.h"
 #include "sus/iter/adaptors/take.h"
 #include "sus/iter/adaptors/take_while.h"
@@ -18,8 +18,10 @@
 
 #include <concepts>
 #include <type_traits>
+#include <utility>
 
 #include "sus/lib/__private/forward_decl.h"
+#include "sus/marker/unsafe.h"
 #include "sus/ptr/subclass.h"
 
 namespace sus::iter {
@@ -177,4 +179,111 @@ concept TrustedLen = requires(const std::remove_cvref_t<T>& t) {
   { t.trusted_len() } -> std::same_as<__private::TrustedLenMarker>;
 };
 
+namespace __private {
+
+struct TrustedRandomAccessMarker {};
+
+/// An iterator whose remaining items can be accessed by index, without
+/// advancing the iterator.
+///
+/// This allows an iterator that walks other iterators in lockstep, such as
+/// [`Zip`]($sus::iter::Zip), to keep a single counter and index each of them,
+/// rather than checking each of them for their end. The resulting loop is a
+/// single counted loop which the compiler can vectorize.
+///
+/// # Implementing TrustedRandomAccess
+/// The iterator must also satisfy `ExactSizeIterator`, and provide:
+/// * A `trusted_random_access() const` method that returns the
+///   `TrustedRandomAccessMarker` type.
+/// * A `get_unchecked(UnsafeFnMarker, usize i)` method that returns the item
+///   `i` places after the front of the iterator, without changing the state of
+///   the iterator.
+/// * An `advance_unchecked(UnsafeFnMarker, usize n)` method that moves the
+///   front of the iterator forward by `n` items without producing them.
+///
+/// # Safety
+/// Callers of `get_unchecked()` must ensure that `i` is less than
+/// `exact_size_hint()`, and must not call it more than once for the same index,
+/// as the item may be produced by a closure with side effects. Calling
+/// `next()` or `next_back()` on the iterator afterward will produce items which
+/// were already seen through `get_unchecked()`, unless the iterator is first
+/// moved past them with `advance_unchecked()`. Callers of
+/// `advance_unchecked()` must ensure that `n` is at most `exact_size_hint()`.
+///
+/// # Side effects
+/// Items that are skipped over with `advance_unchecked()`, or never indexed,
+/// are not produced, so any side effects of producing them do not happen. An
+/// iterator walking others by index may therefore run fewer side effects than
+/// it would by calling `next()` on each of them, such as when `Zip` ends at
+/// the shortest of iterators with different lengths.
+template <class T>
+concept TrustedRandomAccess =
+    ExactSizeIterator<T> &&
+    requires(std::remove_cvref_t<T>& t, ::sus::num::usize i) {
+      {
+        std::as_const(t).trusted_random_access()
+      } -> std::same_as<TrustedRandomAccessMarker>;
+      {
+        t.get_unchecked(::sus::marker::unsafe_fn, i)
+      } -> std::same_as<typename std::remove_cvref_t<T>::Item>;
+      {
+        t.advance_unchecked(::sus::marker::unsafe_fn, i)
+      } -> std::same_as<void>;
+    };
+
+/// An iterator whose remaining items are (copies of) an array of `Elem` which
+/// is contiguous in memory.
+///
+/// This allows operations over the whole iterator, such as `sum()`, to be
+/// performed with loops over the array that the compiler can vectorize.
+///
+/// # Implementing ContiguousIterator
+/// The iterator must also satisfy `ExactSizeIterator`, and provide a
+/// `contiguous_data(UnsafeFnMarker) const` method that returns a pointer to the
+/// item at the front of the iterator. The `exact_size_hint()` of the iterator
+/// is the number of items in the array.
+///
+/// # Safety
+/// The pointer may only be used to read the items, and only until the
+/// iterator is used again or destroyed.
+template <class T, class Elem>
+concept ContiguousIterator =
+    ExactSizeIterator<T> && requires(const std::remove_cvref_t<T>& t) {
+      {
+        t.contiguous_data(::sus::marker::unsafe_fn)
+      } -> std::same_as<const Elem*>;
+    };
+
+struct InPlaceSourceMarker {};
+
+/// An iterator which owns the heap allocation holding its items, and which can
+/// reuse that allocation to hold a `Vec<U>` built by mapping each of its items
+/// to a `U`. This requires `U` to have the same size and alignment as the
+/// iterator's items.
+///
+/// This allows `it.map(f).collect_vec()` to convert the items in place without
+/// allocating.
+///
+/// # Implementing InPlaceSource
+/// The iterator must provide:
+/// * An `in_place_source() const` method that returns the
+///   `InPlaceSourceMarker` type.
+/// * A `map_collect_in_place<U>(UnsafeFnMarker, F& f) &&` method that consumes
+///   the iterator and returns a `Vec<U>` of the results of calling `f` on each
+///   remaining item, in the allocation that held the items.
+///
+/// # Safety
+/// The method is not `constexpr` as it reuses memory for a different type, so
+/// it must not be called in a constant expression.
+template <class T, class U>
+concept InPlaceSource =
+    requires(const std::remove_cvref_t<T>& t) {
+      { t.in_place_source() } -> std::same_as<InPlaceSourceMarker>;
+    } &&  //
+    !std::is_reference_v<U> && !std::is_reference_v<typename T::Item> &&
+    sizeof(U) == sizeof(typename T::Item) &&
+    alignof(U) == alignof(typename T::Item);
+
+}  // namespace __private
+
 }  // namespace sus::iter
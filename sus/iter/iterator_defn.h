@@ -22,6 +22,8 @@
 #include "sus/construct/default.h"
 #include "sus/construct/into.h"
 #include "sus/fn/fn.h"
+#include "sus/iter/__private/flatten_each.h"
+#include "sus/iter/__private/fused_fn.h"
 #include "sus/iter/__private/is_generator.h"
 #include "sus/iter/__private/iter_compare.h"
 #include "sus/iter/__private/iterator_end.h"
@@ -33,7 +35,9 @@
 #include "sus/iter/sum.h"
 #include "sus/lib/__private/forward_decl.h"
 #include "sus/macros/__private/compiler_bugs.h"
+#include "sus/marker/unsafe.h"
 #include "sus/mem/addressof.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/size_of.h"
 #include "sus/num/unsigned_integer.h"
@@ -118,6 +122,46 @@ class IteratorBase {
 
   // Provided final methods.
 
+  /// Creates an iterator which yields `N` elements of the iterator at a time,
+  /// in an [`Array`]($sus::collections::Array).
+  ///
+  /// The chunks do not overlap. If `N` does not divide the number of elements
+  /// in the iterator, then the last up to `N - 1` elements are not yielded in
+  /// an `Array`. They can be retrieved with `into_remainder()` on the returned
+  /// iterator once it is exhausted.
+  ///
+  /// Since the size of each chunk is known at compile time, the compiler can
+  /// unroll and vectorize operations over each chunk, unlike over the slices
+  /// from [`chunks_exact()`]($sus::collections::Slice::chunks_exact). No
+  /// memory is allocated.
+  ///
+  /// An [`Array`]($sus::collections::Array) can not hold references, so to
+  /// chunk an iterator over references, use `copied()` or `cloned()` first.
+  template <size_t N>
+    requires(N > 0u && !std::is_reference_v<Item>)
+  constexpr Iterator<::sus::collections::Array<Item, N>> auto
+  array_chunks() && noexcept;
+
+  /// Creates an iterator which yields the elements of the iterator in batches
+  /// of up to `batch_size` elements.
+  ///
+  /// Each batch is a [`SliceMut`]($sus::collections::SliceMut) into a buffer
+  /// owned by the returned iterator, which is reused for every batch, so only
+  /// a single allocation is made. The slice is only valid until the next call
+  /// to `next()`; elements that are needed for longer can be moved out of it.
+  /// The last batch may be shorter than `batch_size`.
+  ///
+  /// This is useful for processing elements in blocks, such as for bulk
+  /// operations or vectorized kernels, when the iterator is not over a
+  /// contiguous collection which could be split with
+  /// [`chunks()`]($sus::collections::Slice::chunks).
+  ///
+  /// # Panics
+  /// The `batch_size` must be greater than 0, or the function will panic.
+  constexpr Iterator<::sus::collections::SliceMut<Item>> auto batched(
+      usize batch_size) && noexcept
+    requires(!std::is_reference_v<Item>);
+
   /// Takes two iterators and creates a new iterator over both in sequence.
   ///
   /// `chain()` will return a new iterator which will first iterate over values
@@ -132,6 +176,34 @@ class IteratorBase {
   template <IntoIterator<ItemT> Other>
   constexpr Iterator<Item> auto chain(Other&& other) && noexcept;
 
+  /// Creates an iterator over groups of consecutive elements which have the
+  /// same key.
+  ///
+  /// The `key_fn` is called once for each element. Each group is itself an
+  /// iterator, a [`ChunkByGroup`]($sus::iter::ChunkByGroup), which yields the
+  /// elements of the group as they are pulled from this iterator, and
+  /// provides the key of the group from `key()`. No memory is allocated, so
+  /// this can be used to aggregate runs of a sorted stream of elements of any
+  /// length.
+  ///
+  /// The group refers to the iterator returned from `chunk_by()`, so it must
+  /// be used before that iterator is moved or destroyed. Advancing to the next
+  /// group skips any elements that remain in the current one, which then
+  /// returns `None`.
+  ///
+  /// To group the elements of a slice into subslices, use
+  /// [`Slice::chunk_by`]($sus::collections::Slice::chunk_by).
+  template <::sus::fn::FnMut<
+                ::sus::fn::NonVoid(const std::remove_reference_t<ItemT>&)>
+                KeyFn,
+            int&...,
+            class Key = std::invoke_result_t<
+                KeyFn&, const std::remove_reference_t<ItemT>&>>
+    requires(::sus::cmp::Eq<Key> &&  //
+             !std::is_reference_v<Key>)
+  constexpr Iterator<ChunkByGroup<Iter, KeyFn>> auto chunk_by(
+      KeyFn key_fn) && noexcept;
+
   /// Creates an iterator which clones all of its elements.
   ///
   /// This is useful when you have an iterator over `T&`, but you need an
@@ -194,6 +266,38 @@ class IteratorBase {
   constexpr Iterator<Item> auto cycle() && noexcept
     requires(::sus::mem::Clone<Iter>);
 
+  /// Creates an iterator which removes consecutive repeated elements.
+  ///
+  /// Of each run of equal elements, only the first is returned. If the
+  /// iterator is sorted, this removes all duplicates.
+  constexpr Iterator<Item> auto dedup() && noexcept
+    requires(::sus::cmp::Eq<Item>);
+
+  /// Creates an iterator which removes consecutive elements that the `same`
+  /// function considers repeats.
+  ///
+  /// The `same` function is passed the last element that was kept and the
+  /// element that follows it. If it returns true, the latter is skipped. Of
+  /// each run of repeats, only the first element is returned.
+  constexpr Iterator<Item> auto dedup_by(
+      ::sus::fn::FnMut<bool(
+          const std::remove_reference_t<Item>&,
+          const std::remove_reference_t<Item>&)> auto same) && noexcept;
+
+  /// Creates an iterator which removes consecutive elements that have the same
+  /// key.
+  ///
+  /// Of each run of elements with equal keys, only the first is returned.
+  template <::sus::fn::FnMut<
+                ::sus::fn::NonVoid(const std::remove_reference_t<ItemT>&)>
+                KeyFn,
+            int&...,
+            class Key = std::invoke_result_t<
+                KeyFn&, const std::remove_reference_t<ItemT>&>>
+    requires(::sus::cmp::Eq<Key> &&  //
+             !std::is_reference_v<Key>)
+  constexpr Iterator<Item> auto dedup_by_key(KeyFn key_fn) && noexcept;
+
   /// Creates an iterator which gives the current iteration count as well as the
   /// next value.
   ///
@@ -237,6 +341,10 @@ class IteratorBase {
   ///
   /// Given an element the closure must return true or false. The returned
   /// iterator will yield only the elements for which the closure returns true.
+  ///
+  /// When called on the iterator returned from `map()`, `filter()` or
+  /// `filter_map()`, the closures are combined into a single adaptor over the
+  /// same inner iterator, rather than wrapping one adaptor in another.
   constexpr Iterator<Item> auto filter(
       ::sus::fn::FnMut<bool(const std::remove_reference_t<Item>&)> auto
           pred) && noexcept;
@@ -301,6 +409,13 @@ class IteratorBase {
   /// of indirection.
   ///
   /// In other words, this type maps `Iterator[Iterable[T]]` into `Iterator[T]`.
+  ///
+  /// Iterables that are received by const reference, such as when flattening
+  /// the iterator from [`Vec::iter`]($sus::collections::Vec::iter) over a
+  /// `Vec<Vec<T>>`, are iterated through their `iter()` method, producing
+  /// const references to their items. When the outer iterator is over
+  /// contiguous memory and each iterable has a `len()`, the flattened
+  /// iterator knows its exact size.
   constexpr auto flatten() && noexcept
     requires(IntoIteratorAny<Item>);
 
@@ -329,6 +444,13 @@ class IteratorBase {
   /// Note: `reduce()` can be used to use the first element as the initial
   /// value, if the accumulator type and item type is the same.
   ///
+  /// Note: Iterator types may provide their own `fold()` which walks their
+  /// items in a single loop instead of through `next()`. The adaptors in
+  /// [`sus::iter`]($sus::iter) pass `fold()` through to the iterator they
+  /// wrap, so a chain ending in an iterator over a slice becomes a plain loop
+  /// over the slice. Other methods which consume the whole iterator, such as
+  /// `for_each()`, `count()` and `sum()`, are implemented with `fold()`.
+  ///
   /// Note: `fold()` combines elements in a left-associative fashion. For
   /// associative operators like `+`, the order the elements are combined in is
   /// not important, but for non-associative operators like `-` the order will
@@ -438,6 +560,112 @@ class IteratorBase {
           const std::remove_reference_t<Item>&,
           const std::remove_reference_t<Item>&)> auto compare) noexcept;
 
+  /// Returns the `k` largest elements of the iterator, in descending order.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for more.
+  constexpr Iterator<Item> auto k_largest(usize k) && noexcept
+    requires(::sus::cmp::Ord<Item>);
+
+  /// Returns the `k` largest elements of the iterator with respect to the given
+  /// comparison function, in descending order.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for more.
+  constexpr Iterator<Item> auto k_largest_by(
+      usize k,
+      ::sus::fn::FnMut<std::weak_ordering(
+          const std::remove_reference_t<Item>&,
+          const std::remove_reference_t<Item>&)> auto compare) && noexcept;
+
+  /// Returns the `k` elements of the iterator that give the largest values
+  /// from the specified function, in descending order.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for more.
+  template <::sus::fn::FnMut<
+                ::sus::fn::NonVoid(const std::remove_reference_t<ItemT>&)>
+                KeyFn,
+            int&...,
+            class Key = std::invoke_result_t<
+                KeyFn&, const std::remove_reference_t<ItemT>&>>
+    requires(::sus::cmp::Ord<Key>)
+  constexpr Iterator<Item> auto k_largest_by_key(usize k,
+                                                 KeyFn fn) && noexcept;
+
+  /// Returns the `k` smallest elements of the iterator, in ascending order.
+  ///
+  /// The iterator is consumed, while only the `k` smallest elements seen so
+  /// far are kept in a binary heap. This reduces a stream of `n` elements in
+  /// `O(n * log(k))` time with `O(k)` memory, without collecting the whole
+  /// stream in order to sort it. If the iterator has fewer than `k` elements,
+  /// all of them are returned.
+  ///
+  /// The order of equal elements is unspecified.
+  ///
+  /// # Example
+  /// ```
+  /// auto v = sus::Vec<i32>(5, 8, 1, 9, 3, 7);
+  /// auto smallest = v.iter().k_smallest(3u).copied().collect_vec();
+  /// sus_check(smallest == sus::Vec<i32>(1, 3, 5));
+  /// ```
+  constexpr Iterator<Item> auto k_smallest(usize k) && noexcept
+    requires(::sus::cmp::Ord<Item>);
+
+  /// Returns the `k` smallest elements of the iterator with respect to the
+  /// given comparison function, in ascending order.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for more.
+  constexpr Iterator<Item> auto k_smallest_by(
+      usize k,
+      ::sus::fn::FnMut<std::weak_ordering(
+          const std::remove_reference_t<Item>&,
+          const std::remove_reference_t<Item>&)> auto compare) && noexcept;
+
+  /// Returns the `k` elements of the iterator that give the smallest values
+  /// from the specified function, in ascending order.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for more.
+  template <::sus::fn::FnMut<
+                ::sus::fn::NonVoid(const std::remove_reference_t<ItemT>&)>
+                KeyFn,
+            int&...,
+            class Key = std::invoke_result_t<
+                KeyFn&, const std::remove_reference_t<ItemT>&>>
+    requires(::sus::cmp::Ord<Key>)
+  constexpr Iterator<Item> auto k_smallest_by_key(usize k,
+                                                  KeyFn fn) && noexcept;
+
+  /// Merges an iterator over sorted iterators into a single sorted iterator.
+  ///
+  /// Each element of this iterator must be an iterator, or something that can
+  /// be turned into an iterator with `into_iter()`, such as a sorted `Vec`. The
+  /// resulting iterator yields all of their elements in sorted order, keeping
+  /// the iterators in a binary heap so that producing each element costs
+  /// `O(log k)` for `k` iterators, without collecting or sorting the elements.
+  ///
+  /// The order in which equal elements from different iterators are returned
+  /// is unspecified. To merge just two iterators, use
+  /// [`merge`]($sus::iter::IteratorBase::merge) which is stable.
+  template <int&..., class Iterables = ItemT,
+            class InnerIter = IntoIteratorOutputType<Iterables>>
+    requires(IntoIteratorAny<Iterables> &&
+             ::sus::cmp::Ord<typename InnerIter::Item>)
+  constexpr Iterator<typename InnerIter::Item> auto kmerge() && noexcept;
+
+  /// Merges an iterator over sorted iterators into a single iterator, sorted
+  /// with respect to the given comparison function.
+  ///
+  /// See [`kmerge`]($sus::iter::IteratorBase::kmerge) for more.
+  template <class CmpFn, int&..., class Iterables = ItemT,
+            class InnerIter = IntoIteratorOutputType<Iterables>>
+    requires(IntoIteratorAny<Iterables> &&
+             ::sus::fn::FnMut<
+                 CmpFn, std::weak_ordering(
+                            const std::remove_reference_t<
+                                typename InnerIter::Item>&,
+                            const std::remove_reference_t<
+                                typename InnerIter::Item>&)>)
+  constexpr Iterator<typename InnerIter::Item> auto kmerge_by(
+      CmpFn compare) && noexcept;
+
   /// Determines if the elements of this Iterator are
   /// [lexicographically]($sus::cmp::Ord#how-can-i-implement-ord?)
   /// less than or equal to those of another.
@@ -465,6 +693,12 @@ class IteratorBase {
   /// type.
   ///
   /// The returned iterator's type is whatever is returned by the closure.
+  ///
+  /// When called on the iterator returned from `map()`, `filter()` or
+  /// `filter_map()`, the closures are combined into a single adaptor over the
+  /// same inner iterator, rather than wrapping one adaptor in another. A chain
+  /// of `map()` calls remains a [`Map`]($sus::iter::Map), keeping the
+  /// exact size and random access of the inner iterator.
   template <::sus::fn::FnMut<::sus::fn::NonVoid(ItemT&&)> MapFn, int&...,
             class R = std::invoke_result_t<MapFn&, ItemT&&>>
   constexpr Iterator<R> auto map(MapFn fn) && noexcept;
@@ -482,6 +716,54 @@ class IteratorBase {
     requires(::sus::option::__private::IsOptionType<R>::value)
   constexpr Iterator<InnerR> auto map_while(MapFn fn) && noexcept;
 
+  /// Merges this iterator with another, where both are sorted, into a single
+  /// sorted iterator.
+  ///
+  /// Each call to `next()` compares the next elements of the two iterators and
+  /// returns the lesser one, so no elements are collected or sorted. When
+  /// elements are equal, the ones from this iterator are returned first, so
+  /// the merge is stable.
+  ///
+  /// To merge more than two sorted iterators, use
+  /// [`kmerge`]($sus::iter::IteratorBase::kmerge).
+  template <IntoIterator<ItemT> Other>
+    requires(::sus::cmp::Ord<ItemT>)
+  constexpr Iterator<Item> auto merge(Other&& other) && noexcept;
+
+  /// Merges this iterator with another, where both are sorted with respect to
+  /// the given comparison function, into a single sorted iterator.
+  ///
+  /// See [`merge`]($sus::iter::IteratorBase::merge) for more.
+  template <IntoIterator<ItemT> Other>
+  constexpr Iterator<Item> auto merge_by(
+      Other&& other,
+      ::sus::fn::FnMut<std::weak_ordering(
+          const std::remove_reference_t<Item>&,
+          const std::remove_reference_t<Item>&)> auto compare) && noexcept;
+
+  /// Joins this iterator with another, where both are sorted, by pairing up
+  /// the elements which compare as equal.
+  ///
+  /// The comparison function receives an element from each iterator. Each call
+  /// to `next()` returns a `Tuple` of an `Option` from each iterator:
+  /// * If the element from this iterator is less, it is returned alone with
+  ///   `None` from the other.
+  /// * If the element from the other iterator is less, it is returned alone
+  ///   with `None` from this one.
+  /// * If they are equal, both are returned.
+  ///
+  /// This visits the elements of both iterators in a single pass, which can be
+  /// used to diff or join two sorted sequences of different types.
+  template <IntoIteratorAny Other, int&...,
+            class OtherItem = typename IntoIteratorOutputType<Other>::Item,
+            class CmpFn>
+    requires(::sus::fn::FnMut<
+             CmpFn, std::weak_ordering(const std::remove_reference_t<ItemT>&,
+                                       const std::remove_reference_t<
+                                           OtherItem>&)>)
+  constexpr Iterator<::sus::Tuple<Option<ItemT>, Option<OtherItem>>> auto
+  merge_join_by(Other&& other, CmpFn compare) && noexcept;
+
   /// Returns the maximum element of an iterator.
   ///
   /// If several elements are equally maximum, the last element is returned. If
@@ -581,6 +863,42 @@ class IteratorBase {
     requires(::sus::cmp::Eq<ItemT, OtherItem>)
   constexpr bool ne(Other&& other) && noexcept;
 
+  /// Advances the iterator and returns an array containing the next `N`
+  /// values.
+  ///
+  /// If there are not enough elements to fill the array then `Err` is
+  /// returned containing the elements that were pulled from the iterator. The
+  /// first `k` elements of the returned array are `Some`, where `k` is the
+  /// number of elements that remained in the iterator, and the rest are
+  /// `None`.
+  ///
+  /// Iterators that know their remaining elements can produce the array
+  /// without checking each element for the end of the iteration. Those with
+  /// random access to their elements, such as the iterators over a slice
+  /// after `copied()` or `map()`, construct the array directly from them and
+  /// then advance past all `N` at once.
+  ///
+  /// An [`Array`]($sus::collections::Array) can not hold references, so to
+  /// pull chunks from an iterator over references, use `copied()` or
+  /// `cloned()` first.
+  ///
+  /// # Examples
+  /// ```
+  /// auto it = sus::Vec<i32>(1, 2, 3, 4, 5).into_iter();
+  /// sus_check(it.next_chunk<2>().unwrap() == sus::Array<i32, 2>(1, 2));
+  /// sus_check(it.next_chunk<2>().unwrap() == sus::Array<i32, 2>(3, 4));
+  /// // Only one element remains to fill the array.
+  /// auto partial = it.next_chunk<2>().unwrap_err();
+  /// sus_check(partial[0u] == sus::some(5));
+  /// sus_check(partial[1u] == sus::none());
+  /// ```
+  template <size_t N>
+    requires(!std::is_reference_v<Item>)
+  constexpr ::sus::result::Result<
+      ::sus::collections::Array<Item, N>,
+      ::sus::collections::Array<Option<Item>, N>>
+  next_chunk() noexcept;
+
   /// Returns the nth element of the iterator.
   ///
   /// Like most indexing operations, the count starts from zero, so `nth(0u)`
@@ -664,6 +982,36 @@ class IteratorBase {
   /// method will occur.
   constexpr Iterator<Item> auto peekable() && noexcept;
 
+  /// Creates an iterator which can use the `peek_nth()` and `peek_nth_mut()`
+  /// methods to look at any of the next `N` elements of the iterator without
+  /// consuming them.
+  ///
+  /// This is like [`peekable()`]($sus::iter::IteratorBase::peekable), but
+  /// with a lookahead of `N` elements instead of one. The elements are held in
+  /// a ring buffer of size `N` inside the returned iterator, so arbitrary
+  /// (bounded) lookahead does not require collecting the iterator into a
+  /// `Vec`.
+  ///
+  /// The underlying iterator is advanced as far as needed to return the
+  /// element from `peek_nth(n)`.
+  ///
+  /// # Example
+  /// ```
+  /// auto v = sus::Vec<char>('a', '-', '>', 'b');
+  /// auto it = v.iter().peekable<2>();
+  /// sus_check(it.next_if_eq('a').is_some());
+  /// // Look for an arrow before consuming anything.
+  /// if (it.peek_nth(0u).copied() == sus::some('-') &&
+  ///     it.peek_nth(1u).copied() == sus::some('>')) {
+  ///   it.next();
+  ///   it.next();
+  /// }
+  /// sus_check(it.next() == sus::some('b'));
+  /// ```
+  template <size_t N>
+    requires(N > 0u)
+  constexpr Iterator<Item> auto peekable() && noexcept;
+
   /// Searches for an element in an iterator, returning its index.
   ///
   /// `position()` takes a closure that returns `true` or `false`. It applies
@@ -685,6 +1033,25 @@ class IteratorBase {
   constexpr Option<usize> position(
       ::sus::fn::FnMut<bool(Item&&)> auto pred) noexcept;
 
+  /// Creates an iterator which prefetches memory for the items `distance`
+  /// steps ahead of each item it yields.
+  ///
+  /// The `addr_fn` receives a reference to each upcoming item and returns the
+  /// address to prefetch, which may be the item itself or memory it points to,
+  /// such as the contents of a [`Box`]($sus::boxed::Box). This allows loops
+  /// that chase pointers out of an iterator to avoid stalling on memory.
+  ///
+  /// The iterator is cloned in order to look ahead of the items being yielded,
+  /// so it should be cheap to clone, such as an iterator over a slice. Any
+  /// adaptors in the iterator will run twice for each item, once to look ahead
+  /// and once to yield the item. To prefetch the items of a slice themselves,
+  /// the slice iterators' `prefetch()` finds them without a clone.
+  constexpr Iterator<Item> auto prefetch_by(
+      ::sus::fn::FnMut<const void*(const std::remove_reference_t<Item>&)> auto
+          addr_fn,
+      usize distance) && noexcept
+    requires(::sus::mem::Clone<Iter>);
+
   /// Iterates over the entire iterator, multiplying all the elements.
   ///
   /// An empty iterator returns the "one" value of the type.
@@ -701,7 +1068,11 @@ class IteratorBase {
   ///
   /// Using `product<OverflowInteger<T>>()` will allow the caller to handle
   /// overflow without a panic.
-  template <class P = ItemT>
+  ///
+  /// An iterator over references, such as from
+  /// [`Slice::iter()`]($sus::collections::Slice::iter), multiplies to the type
+  /// being referred to.
+  template <class P = std::remove_cvref_t<ItemT>>
     requires(Product<P, ItemT>)
   constexpr P product() && noexcept;
 
@@ -874,6 +1245,36 @@ class IteratorBase {
       ::sus::fn::FnMut<bool(const std::remove_reference_t<Item>&)> auto
           pred) && noexcept;
 
+  /// Returns the elements of this iterator which are not found in another,
+  /// where both are sorted.
+  ///
+  /// Like `std::set_difference`, if an element appears `m` times in this
+  /// iterator and `n` times in the other, it is returned `max(m - n, 0)`
+  /// times. The result is sorted.
+  template <IntoIterator<ItemT> Other>
+    requires(::sus::cmp::Ord<ItemT>)
+  constexpr Iterator<Item> auto sorted_difference(Other&& other) && noexcept;
+
+  /// Returns the elements of this iterator which are also found in another,
+  /// where both are sorted.
+  ///
+  /// Like `std::set_intersection`, if an element appears `m` times in this
+  /// iterator and `n` times in the other, it is returned `min(m, n)` times,
+  /// taken from this iterator. The result is sorted.
+  template <IntoIterator<ItemT> Other>
+    requires(::sus::cmp::Ord<ItemT>)
+  constexpr Iterator<Item> auto sorted_intersection(Other&& other) && noexcept;
+
+  /// Returns the elements which are found in this iterator or another, where
+  /// both are sorted.
+  ///
+  /// Like `std::set_union`, if an element appears `m` times in this iterator
+  /// and `n` times in the other, it is returned `max(m, n)` times, with equal
+  /// elements taken from this iterator first. The result is sorted.
+  template <IntoIterator<ItemT> Other>
+    requires(::sus::cmp::Ord<ItemT>)
+  constexpr Iterator<Item> auto sorted_union(Other&& other) && noexcept;
+
   /// Creates an iterator starting at the same point, but stepping by the given
   /// amount at each iteration.
   ///
@@ -935,7 +1336,12 @@ class IteratorBase {
   ///
   /// Using `sum<OverflowInteger<T>>()` will allow the caller to handle overflow
   /// without a panic.
-  template <class P = ItemT>
+  ///
+  /// An iterator over references, such as from
+  /// [`Slice::iter()`]($sus::collections::Slice::iter), sums to the type being
+  /// referred to. For an iterator over a slice of numbers, the sum is computed
+  /// with loops that the compiler can vectorize.
+  template <class P = std::remove_cvref_t<ItemT>>
     requires(Sum<P, ItemT>)
   constexpr P sum() && noexcept;
 
@@ -1134,6 +1540,34 @@ class IteratorBase {
   // TODO: If the iterator is over references, collect_vec() could map them to
   // NonNull.
   constexpr ::sus::collections::Vec<ItemT> collect_vec() && noexcept;
+
+  /// Transforms an iterator into the given Vec, replacing its contents.
+  ///
+  /// The `vec` is cleared and then filled with the iterator's items. Its
+  /// capacity is kept, so no allocation happens if it is already large enough
+  /// to hold the items. This allows a loop that repeatedly collects into the
+  /// same `Vec` to reuse its storage.
+  ///
+  /// Returns a reference to `vec`.
+  ///
+  /// To append to a `Vec` without clearing it, use
+  /// [`Vec::extend`]($sus::collections::Vec::extend).
+  ///
+  /// # Panics
+  /// Panics if `vec` has any outstanding iterators, as with
+  /// [`Vec::clear`]($sus::collections::Vec::clear).
+  constexpr ::sus::collections::Vec<ItemT>& collect_into(
+      ::sus::collections::Vec<ItemT>& vec) && noexcept;
+
+  /// Transforms an iterator into a Vec, reusing the storage of `vec`.
+  ///
+  /// This is like `collect_vec()`, but the returned `Vec` is `vec` with its
+  /// contents replaced by the iterator's items. The capacity of `vec` is kept,
+  /// so no allocation happens if it is already large enough to hold the items.
+  ///
+  /// See `collect_into()` for more details.
+  constexpr ::sus::collections::Vec<ItemT> collect_vec_in(
+      ::sus::collections::Vec<ItemT>&& vec) && noexcept;
 };
 
 template <class Iter, class Item>
@@ -1167,6 +1601,24 @@ constexpr Iterator<Item> auto IteratorBase<Iter, Item>::by_ref() & noexcept {
   return ByRef<Iter>(as_subclass_mut());
 }
 
+template <class Iter, class Item>
+template <size_t N>
+  requires(N > 0u && !std::is_reference_v<Item>)
+constexpr Iterator<::sus::collections::Array<Item, N>> auto
+IteratorBase<Iter, Item>::array_chunks() && noexcept {
+  using ArrayChunks = ArrayChunks<Iter, N>;
+  return ArrayChunks(static_cast<Iter&&>(*this));
+}
+
+template <class Iter, class Item>
+constexpr Iterator<::sus::collections::SliceMut<Item>> auto
+IteratorBase<Iter, Item>::batched(usize batch_size) && noexcept
+  requires(!std::is_reference_v<Item>)
+{
+  using Batched = Batched<Iter>;
+  return Batched(batch_size, static_cast<Iter&&>(*this));
+}
+
 template <class Iter, class Item>
 template <IntoIterator<Item> Other>
 constexpr Iterator<Item> auto IteratorBase<Iter, Item>::chain(
@@ -1175,6 +1627,20 @@ constexpr Iterator<Item> auto IteratorBase<Iter, Item>::chain(
   return Chain(static_cast<Iter&&>(*this), ::sus::move(other).into_iter());
 }
 
+template <class Iter, class Item>
+template <
+    ::sus::fn::FnMut<::sus::fn::NonVoid(const std::remove_reference_t<Item>&)>
+        KeyFn,
+    int&...,
+    class Key>
+  requires(::sus::cmp::Eq<Key> &&  //
+           !std::is_reference_v<Key>)
+constexpr Iterator<ChunkByGroup<Iter, KeyFn>> auto
+IteratorBase<Iter, Item>::chunk_by(KeyFn key_fn) && noexcept {
+  using ChunkBy = ChunkBy<Iter, KeyFn>;
+  return ChunkBy(::sus::move(key_fn), static_cast<Iter&&>(*this));
+}
+
 template <class Iter, class Item>
 constexpr Iterator<std::remove_cvref_t<Item>> auto
 IteratorBase<Iter, Item>::cloned() && noexcept
@@ -1218,9 +1684,8 @@ Iterator<std::remove_cvref_t<Item>> auto constexpr IteratorBase<
 
 template <class Iter, class Item>
 constexpr ::sus::num::usize IteratorBase<Iter, Item>::count() && noexcept {
-  auto c = 0_usize;
-  while (as_subclass_mut().next().is_some()) c += 1_usize;
-  return c;
+  return static_cast<Iter&&>(*this).fold(
+      0_usize, [](::sus::num::usize c, Item&&) { return c + 1_usize; });
 }
 
 template <class Iter, class Item>
@@ -1231,6 +1696,38 @@ constexpr Iterator<Item> auto IteratorBase<Iter, Item>::cycle() && noexcept
   return Cycle(static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::dedup() && noexcept
+  requires(::sus::cmp::Eq<Item>)
+{
+  return static_cast<Iter&&>(*this).dedup_by(
+      [](const std::remove_reference_t<Item>& a,
+         const std::remove_reference_t<Item>& b) { return a == b; });
+}
+
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::dedup_by(
+    ::sus::fn::FnMut<bool(const std::remove_reference_t<Item>&,
+                          const std::remove_reference_t<Item>&)> auto
+        same) && noexcept {
+  using DedupBy = DedupBy<Iter, decltype(same)>;
+  return DedupBy(::sus::move(same), static_cast<Iter&&>(*this));
+}
+
+template <class Iter, class Item>
+template <
+    ::sus::fn::FnMut<::sus::fn::NonVoid(const std::remove_reference_t<Item>&)>
+        KeyFn,
+    int&...,
+    class Key>
+  requires(::sus::cmp::Eq<Key> &&  //
+           !std::is_reference_v<Key>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::dedup_by_key(
+    KeyFn key_fn) && noexcept {
+  using DedupByKey = DedupByKey<Iter, KeyFn>;
+  return DedupByKey(::sus::move(key_fn), static_cast<Iter&&>(*this));
+}
+
 template <class Iter, class Item>
 constexpr auto IteratorBase<Iter, Item>::enumerate() && noexcept {
   using Enumerate = Enumerate<Iter>;
@@ -1263,8 +1760,29 @@ template <class Iter, class Item>
 constexpr Iterator<Item> auto IteratorBase<Iter, Item>::filter(
     ::sus::fn::FnMut<bool(const std::remove_reference_t<Item>&)> auto
         pred) && noexcept {
-  using Filter = Filter<Iter, decltype(pred)>;
-  return Filter(::sus::move(pred), static_cast<Iter&&>(*this));
+  using Pred = decltype(pred);
+  Iter&& self = static_cast<Iter&&>(*this);
+  // The predicate is fused with the closure of a `map()` or `filter()` that
+  // came before it, into a single adaptor over the same inner iterator.
+  if constexpr (__private::IsFilter<Iter>::value) {
+    using Fn = __private::FusedFilterFilter<decltype(self.pred_), Pred>;
+    using Filter = Filter<decltype(self.next_iter_), Fn>;
+    return Filter(Fn{::sus::move(self.pred_), ::sus::move(pred)},
+                  ::sus::move(self.next_iter_));
+  } else if constexpr (__private::IsMap<Iter>::value) {
+    using Fn = __private::FusedMapFilter<Item, decltype(self.fn_), Pred>;
+    using FilterMap = FilterMap<Item, decltype(self.next_iter_), Fn>;
+    return FilterMap(Fn{::sus::move(self.fn_), ::sus::move(pred)},
+                     ::sus::move(self.next_iter_));
+  } else if constexpr (__private::IsFilterMap<Iter>::value) {
+    using Fn = __private::FusedFilterMapFilter<decltype(self.fn_), Pred>;
+    using FilterMap = FilterMap<Item, decltype(self.next_iter_), Fn>;
+    return FilterMap(Fn{::sus::move(self.fn_), ::sus::move(pred)},
+                     ::sus::move(self.next_iter_));
+  } else {
+    using Filter = Filter<Iter, Pred>;
+    return Filter(::sus::move(pred), ::sus::move(self));
+  }
 }
 
 template <class Iter, class Item>
@@ -1313,7 +1831,7 @@ template <class Iter, class Item>
 constexpr auto IteratorBase<Iter, Item>::flatten() && noexcept
   requires(IntoIteratorAny<Item>)
 {
-  using Flatten = Flatten<IntoIteratorOutputType<Item>, Iter>;
+  using Flatten = Flatten<__private::FlattenEachIter<Item>, Iter>;
   return Flatten(static_cast<Iter&&>(*this));
 }
 
@@ -1345,13 +1863,13 @@ constexpr B IteratorBase<Iter, Item>::fold(B init, F f) && noexcept {
 template <class Iter, class Item>
 template <::sus::fn::FnMut<void(Item&&)> F>
 constexpr void IteratorBase<Iter, Item>::for_each(F f) && noexcept {
-  // TODO: Implement with fold()? Allow fold to take B=void?
-  while (true) {
-    if (Option<Item> o = as_subclass_mut().next(); o.is_none())
-      break;
-    else
-      ::sus::fn::call_mut(f, std::move(o).unwrap());
-  }
+  // Implemented with fold() so that iterators which implement internal
+  // iteration are used through it. The accumulator carries nothing.
+  struct Unit {};
+  static_cast<Iter&&>(*this).fold(Unit(), [&f](Unit u, Item&& item) {
+    ::sus::fn::call_mut(f, ::sus::forward<Item>(item));
+    return u;
+  });
 }
 
 template <class Iter, class Item>
@@ -1429,6 +1947,164 @@ constexpr bool IteratorBase<Iter, Item>::is_sorted_by(
   }
 }
 
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::k_largest(
+    usize k) && noexcept
+  requires(::sus::cmp::Ord<Item>)
+{
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [](const std::remove_reference_t<Item>& a,
+            const std::remove_reference_t<Item>& b) { return b <=> a; });
+}
+
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::k_largest_by(
+    usize k,
+    ::sus::fn::FnMut<std::weak_ordering(
+        const std::remove_reference_t<Item>&,
+        const std::remove_reference_t<Item>&)> auto compare) && noexcept {
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [compare = ::sus::move(compare)](
+             const std::remove_reference_t<Item>& a,
+             const std::remove_reference_t<Item>& b) mutable {
+        return ::sus::fn::call_mut(compare, b, a);
+      });
+}
+
+template <class Iter, class Item>
+template <
+    ::sus::fn::FnMut<::sus::fn::NonVoid(const std::remove_reference_t<Item>&)>
+        KeyFn,
+    int&...,
+    class Key>
+  requires(::sus::cmp::Ord<Key>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::k_largest_by_key(
+    usize k, KeyFn fn) && noexcept {
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [fn = ::sus::move(fn)](
+             const std::remove_reference_t<Item>& a,
+             const std::remove_reference_t<Item>& b) mutable {
+        return ::sus::fn::call_mut(fn, b) <=> ::sus::fn::call_mut(fn, a);
+      });
+}
+
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::k_smallest(
+    usize k) && noexcept
+  requires(::sus::cmp::Ord<Item>)
+{
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [](const std::remove_reference_t<Item>& a,
+            const std::remove_reference_t<Item>& b) { return a <=> b; });
+}
+
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::k_smallest_by(
+    usize k,
+    ::sus::fn::FnMut<std::weak_ordering(
+        const std::remove_reference_t<Item>&,
+        const std::remove_reference_t<Item>&)> auto compare) && noexcept {
+  // The elements are held in an Option so that references can be stored in
+  // the Vec.
+  using Heap = ::sus::collections::Vec<Option<Item>>;
+  auto cmp = [&compare](const Option<Item>& a, const Option<Item>& b) {
+    return ::sus::fn::call_mut(compare, a.as_value(), b.as_value());
+  };
+  // Restores the max-heap property for the subtree rooted at `i`.
+  auto sift_down = [&cmp](Heap& heap, usize i) {
+    const usize len = heap.len();
+    while (true) {
+      usize child = i * 2u + 1u;
+      if (child >= len) return;
+      if (child + 1u < len && cmp(heap[child], heap[child + 1u]) < 0)
+        child += 1u;
+      if (cmp(heap[i], heap[child]) >= 0) return;
+      heap.swap(i, child);
+      i = child;
+    }
+  };
+
+  // Only the elements known to be coming are reserved for, up to `k`, and the
+  // heap grows as more are found. Reserving `k` up front would allocate (or
+  // panic on) a huge heap when a large `k` is given for a short iterator.
+  usize capacity = as_subclass().size_hint().lower;
+  if (capacity < 16u) capacity = 16u;
+  if (capacity > k) capacity = k;
+  Heap heap = Heap::with_capacity(capacity);
+  if (k > 0u) {
+    Iter& iter = as_subclass_mut();
+    while (heap.len() < k) {
+      Option<Item> o = iter.next();
+      if (o.is_none()) break;
+      heap.push(::sus::move(o));
+    }
+    if (heap.len() == k) {
+      // Heapify by sifting down each node with children, from the bottom up.
+      for (usize i = k / 2u; i > 0u;) {
+        i -= 1u;
+        sift_down(heap, i);
+      }
+      // The root is the largest of the `k` smallest elements seen so far, and
+      // is replaced by any element that is smaller than it.
+      while (true) {
+        Option<Item> o = iter.next();
+        if (o.is_none()) break;
+        if (cmp(o, heap[0u]) < 0) {
+          heap[0u] = ::sus::move(o);
+          sift_down(heap, 0u);
+        }
+      }
+    }
+  }
+  heap.sort_unstable_by(cmp);
+  return ::sus::move(heap).into_iter().map([](Option<Item>&& o) -> Item {
+    return ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn);
+  });
+}
+
+template <class Iter, class Item>
+template <
+    ::sus::fn::FnMut<::sus::fn::NonVoid(const std::remove_reference_t<Item>&)>
+        KeyFn,
+    int&...,
+    class Key>
+  requires(::sus::cmp::Ord<Key>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::k_smallest_by_key(
+    usize k, KeyFn fn) && noexcept {
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [fn = ::sus::move(fn)](
+             const std::remove_reference_t<Item>& a,
+             const std::remove_reference_t<Item>& b) mutable {
+        return ::sus::fn::call_mut(fn, a) <=> ::sus::fn::call_mut(fn, b);
+      });
+}
+
+template <class Iter, class Item>
+template <int&..., class Iterables, class InnerIter>
+  requires(IntoIteratorAny<Iterables> &&
+           ::sus::cmp::Ord<typename InnerIter::Item>)
+constexpr Iterator<typename InnerIter::Item> auto
+IteratorBase<Iter, Item>::kmerge() && noexcept {
+  using InnerItem = typename InnerIter::Item;
+  return static_cast<Iter&&>(*this).kmerge_by(
+      [](const std::remove_reference_t<InnerItem>& a,
+         const std::remove_reference_t<InnerItem>& b) { return a <=> b; });
+}
+
+template <class Iter, class Item>
+template <class CmpFn, int&..., class Iterables, class InnerIter>
+  requires(IntoIteratorAny<Iterables> &&
+           ::sus::fn::FnMut<
+               CmpFn,
+               std::weak_ordering(
+                   const std::remove_reference_t<typename InnerIter::Item>&,
+                   const std::remove_reference_t<typename InnerIter::Item>&)>)
+constexpr Iterator<typename InnerIter::Item> auto
+IteratorBase<Iter, Item>::kmerge_by(CmpFn compare) && noexcept {
+  using KMergeBy = KMergeBy<InnerIter, CmpFn>;
+  return KMergeBy::from_iters(::sus::move(compare), static_cast<Iter&&>(*this));
+}
+
 template <class Iter, class Item>
 template <IntoIteratorAny Other, int&..., class OtherItem>
   requires(::sus::cmp::PartialOrd<Item, OtherItem>)
@@ -1453,8 +2129,28 @@ constexpr Option<Item> IteratorBase<Iter, Item>::last() && noexcept {
 template <class Iter, class Item>
 template <::sus::fn::FnMut<::sus::fn::NonVoid(Item&&)> MapFn, int&..., class R>
 constexpr Iterator<R> auto IteratorBase<Iter, Item>::map(MapFn fn) && noexcept {
-  using Map = Map<R, Iter, MapFn>;
-  return Map(sus::move(fn), static_cast<Iter&&>(*this));
+  Iter&& self = static_cast<Iter&&>(*this);
+  // The map function is fused with the closure of a `map()` or `filter()`
+  // that came before it, into a single adaptor over the same inner iterator.
+  if constexpr (__private::IsMap<Iter>::value) {
+    using Fn = __private::FusedMapMap<decltype(self.fn_), MapFn>;
+    using Map = Map<R, decltype(self.next_iter_), Fn>;
+    return Map(Fn{::sus::move(self.fn_), ::sus::move(fn)},
+               ::sus::move(self.next_iter_));
+  } else if constexpr (__private::IsFilter<Iter>::value) {
+    using Fn = __private::FusedFilterMap<R, decltype(self.pred_), MapFn>;
+    using FilterMap = FilterMap<R, decltype(self.next_iter_), Fn>;
+    return FilterMap(Fn{::sus::move(self.pred_), ::sus::move(fn)},
+                     ::sus::move(self.next_iter_));
+  } else if constexpr (__private::IsFilterMap<Iter>::value) {
+    using Fn = __private::FusedFilterMapMap<R, decltype(self.fn_), MapFn>;
+    using FilterMap = FilterMap<R, decltype(self.next_iter_), Fn>;
+    return FilterMap(Fn{::sus::move(self.fn_), ::sus::move(fn)},
+                     ::sus::move(self.next_iter_));
+  } else {
+    using Map = Map<R, Iter, MapFn>;
+    return Map(sus::move(fn), ::sus::move(self));
+  }
 }
 
 template <class Iter, class Item>
@@ -1467,6 +2163,44 @@ constexpr Iterator<InnerR> auto IteratorBase<Iter, Item>::map_while(
   return MapWhile(sus::move(fn), static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+template <IntoIterator<Item> Other>
+  requires(::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::merge(
+    Other&& other) && noexcept {
+  return static_cast<Iter&&>(*this).merge_by(
+      ::sus::move(other),
+      [](const std::remove_reference_t<Item>& a,
+         const std::remove_reference_t<Item>& b) { return a <=> b; });
+}
+
+template <class Iter, class Item>
+template <IntoIterator<Item> Other>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::merge_by(
+    Other&& other,
+    ::sus::fn::FnMut<std::weak_ordering(
+        const std::remove_reference_t<Item>&,
+        const std::remove_reference_t<Item>&)> auto compare) && noexcept {
+  using MergeBy =
+      MergeBy<Iter, IntoIteratorOutputType<Other>, decltype(compare)>;
+  return MergeBy(::sus::move(compare), static_cast<Iter&&>(*this),
+                 ::sus::move(other).into_iter());
+}
+
+template <class Iter, class Item>
+template <IntoIteratorAny Other, int&..., class OtherItem, class CmpFn>
+  requires(::sus::fn::FnMut<
+           CmpFn, std::weak_ordering(
+                      const std::remove_reference_t<Item>&,
+                      const std::remove_reference_t<OtherItem>&)>)
+constexpr Iterator<::sus::Tuple<Option<Item>, Option<OtherItem>>> auto
+IteratorBase<Iter, Item>::merge_join_by(Other&& other,
+                                        CmpFn compare) && noexcept {
+  using MergeJoinBy = MergeJoinBy<Iter, IntoIteratorOutputType<Other>, CmpFn>;
+  return MergeJoinBy(::sus::move(compare), static_cast<Iter&&>(*this),
+                     ::sus::move(other).into_iter());
+}
+
 template <class Iter, class Item>
 constexpr Option<Item> IteratorBase<Iter, Item>::max() && noexcept
   requires(::sus::cmp::Ord<Item>)
@@ -1656,6 +2390,14 @@ constexpr Iterator<Item> auto IteratorBase<Iter, Item>::peekable() && noexcept {
   return Peekable(static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+template <size_t N>
+  requires(N > 0u)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::peekable() && noexcept {
+  using PeekableN = PeekableN<Iter, N>;
+  return PeekableN(static_cast<Iter&&>(*this));
+}
+
 template <class Iter, class Item>
 constexpr Option<usize> IteratorBase<Iter, Item>::position(
     ::sus::fn::FnMut<bool(Item&&)> auto pred) noexcept {
@@ -1670,6 +2412,17 @@ constexpr Option<usize> IteratorBase<Iter, Item>::position(
   }
 }
 
+template <class Iter, class Item>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::prefetch_by(
+    ::sus::fn::FnMut<const void*(const std::remove_reference_t<Item>&)> auto
+        addr_fn,
+    usize distance) && noexcept
+  requires(::sus::mem::Clone<Iter>)
+{
+  using Prefetch = Prefetch<Iter, decltype(addr_fn)>;
+  return Prefetch(::sus::move(addr_fn), distance, static_cast<Iter&&>(*this));
+}
+
 template <class Iter, class Item>
 template <class P>
   requires(Product<P, Item>)
@@ -1778,6 +2531,38 @@ constexpr Iterator<Item> auto IteratorBase<Iter, Item>::skip_while(
   return SkipWhile(::sus::move(pred), static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+template <IntoIterator<Item> Other>
+  requires(::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::sorted_difference(
+    Other&& other) && noexcept {
+  using SortedDifference =
+      SortedDifference<Iter, IntoIteratorOutputType<Other>>;
+  return SortedDifference(static_cast<Iter&&>(*this),
+                          ::sus::move(other).into_iter());
+}
+
+template <class Iter, class Item>
+template <IntoIterator<Item> Other>
+  requires(::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::sorted_intersection(
+    Other&& other) && noexcept {
+  using SortedIntersection =
+      SortedIntersection<Iter, IntoIteratorOutputType<Other>>;
+  return SortedIntersection(static_cast<Iter&&>(*this),
+                            ::sus::move(other).into_iter());
+}
+
+template <class Iter, class Item>
+template <IntoIterator<Item> Other>
+  requires(::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::sorted_union(
+    Other&& other) && noexcept {
+  using SortedUnion = SortedUnion<Iter, IntoIteratorOutputType<Other>>;
+  return SortedUnion(static_cast<Iter&&>(*this),
+                     ::sus::move(other).into_iter());
+}
+
 template <class Iter, class Item>
 constexpr Iterator<Item> auto IteratorBase<Iter, Item>::step_by(
     usize step) && noexcept {
@@ -1922,4 +2707,20 @@ IteratorBase<Iter, Item>::collect_vec() && noexcept {
       static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+constexpr ::sus::collections::Vec<Item>& IteratorBase<Iter, Item>::collect_into(
+    ::sus::collections::Vec<Item>& vec) && noexcept {
+  vec.clear();
+  vec.extend(static_cast<Iter&&>(*this));
+  return vec;
+}
+
+template <class Iter, class Item>
+constexpr ::sus::collections::Vec<Item>
+IteratorBase<Iter, Item>::collect_vec_in(
+    ::sus::collections::Vec<Item>&& vec) && noexcept {
+  static_cast<Iter&&>(*this).collect_into(vec);
+  return ::sus::move(vec);
+}
+
 }  // namespace sus::iter
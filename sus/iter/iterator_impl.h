@@ -18,7 +18,13 @@
 
 #include <type_traits>
 
+#include "sus/collections/array.h"
+#include "sus/iter/iterator_concept.h"
 #include "sus/iter/try_from_iterator.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/replace.h"
+#include "sus/result/result.h"
 
 namespace sus::iter {
 
@@ -35,4 +41,52 @@ constexpr auto IteratorBase<Iter, Item>::try_collect() noexcept {
   return ::sus::iter::try_from_iter<C>(static_cast<Iter&&>(*this));
 }
 
+// Implementation of IteratorBase::next_chunk has to live here to avoid
+// cyclical includes, as Result needs to see IteratorBase.
+template <class Iter, class Item>
+template <size_t N>
+  requires(!std::is_reference_v<Item>)
+constexpr ::sus::result::Result<::sus::collections::Array<Item, N>,
+                                ::sus::collections::Array<Option<Item>, N>>
+IteratorBase<Iter, Item>::next_chunk() noexcept {
+  using Chunk = ::sus::collections::Array<Item, N>;
+  using Partial = ::sus::collections::Array<Option<Item>, N>;
+  using Out = ::sus::result::Result<Chunk, Partial>;
+  Iter& self = as_subclass_mut();
+  if constexpr (__private::TrustedRandomAccess<Iter>) {
+    if (self.exact_size_hint() >= N) {
+      // SAFETY: There are at least `N` items remaining, so each index is less
+      // than `exact_size_hint()`, and each is visited once before advancing
+      // past all of them.
+      auto chunk = Chunk::with_initializer([&self, i = 0_usize]() mutable {
+        return self.get_unchecked(::sus::marker::unsafe_fn,
+                                  ::sus::mem::replace(i, i + 1u));
+      });
+      self.advance_unchecked(::sus::marker::unsafe_fn, N);
+      return Out(::sus::move(chunk));
+    }
+  } else if constexpr (TrustedLen<Iter>) {
+    // When there are at least `N` more elements, the array can be built
+    // directly from the iterator without checking each element.
+    if (self.size_hint().lower >= N) {
+      return Out(Chunk::with_initializer([&self]() {
+        return self.next().unwrap_unchecked(::sus::marker::unsafe_fn);
+      }));
+    }
+  }
+  Partial partial;
+  for (usize i; i < N; i += 1u) {
+    Option<Item> o = self.next();
+    if (o.is_none()) return Out::with_err(::sus::move(partial));
+    partial.get_unchecked_mut(::sus::marker::unsafe_fn, i) = ::sus::move(o);
+  }
+  return Out(Chunk::with_initializer([&partial, i = 0_usize]() mutable {
+    return partial
+        .get_unchecked_mut(::sus::marker::unsafe_fn,
+                           ::sus::mem::replace(i, i + 1u))
+        .take()
+        .unwrap_unchecked(::sus::marker::unsafe_fn);
+  }));
+}
+
 }  // namespace sus::iter
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "sus/marker/unsafe.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/replace.h"
@@ -23,12 +25,69 @@
 static_assert(SUS_ITERATOR_INVALIDATION == 0 || SUS_ITERATOR_INVALIDATION == 1);
 #endif
 
+// SUS_ITERATOR_INVALIDATION_ATOMIC can be defined to 1 to make the iterator
+// invalidation ref-counts atomic, which allows a collection to be iterated from
+// multiple threads concurrently. It has no effect when
+// SUS_ITERATOR_INVALIDATION is 0.
+#if !defined(SUS_ITERATOR_INVALIDATION_ATOMIC)
+#define SUS_ITERATOR_INVALIDATION_ATOMIC 0
+#endif
+static_assert(SUS_ITERATOR_INVALIDATION_ATOMIC == 0 ||
+              SUS_ITERATOR_INVALIDATION_ATOMIC == 1);
+
+#if SUS_ITERATOR_INVALIDATION_ATOMIC
+#  include <atomic>
+#endif
+
 namespace sus::iter {
 
 struct IterRefCounter;
 
 #if !defined(SUS_ITERATOR_INVALIDATION) || SUS_ITERATOR_INVALIDATION
 
+namespace __private {
+
+/// Adds `n` to an iterator ref-count. When SUS_ITERATOR_INVALIDATION_ATOMIC is
+/// enabled, this is a relaxed atomic operation outside of constant evaluation.
+/// The ref-counts only need to be eventually consistent with the owning
+/// collection, which synchronizes with the threads it shares itself with
+/// before being mutated, so no ordering is required.
+constexpr inline void iter_ref_add(usize& count, usize n) noexcept {
+#if SUS_ITERATOR_INVALIDATION_ATOMIC
+  if (!std::is_constant_evaluated()) {
+    std::atomic_ref(count.primitive_value)
+        .fetch_add(n.primitive_value, std::memory_order_relaxed);
+    return;
+  }
+#endif
+  count += n;
+}
+
+/// Subtracts `n` from an iterator ref-count. See `iter_ref_add()`.
+constexpr inline void iter_ref_sub(usize& count, usize n) noexcept {
+#if SUS_ITERATOR_INVALIDATION_ATOMIC
+  if (!std::is_constant_evaluated()) {
+    std::atomic_ref(count.primitive_value)
+        .fetch_sub(n.primitive_value, std::memory_order_relaxed);
+    return;
+  }
+#endif
+  count -= n;
+}
+
+/// Reads an iterator ref-count. See `iter_ref_add()`.
+constexpr inline usize iter_ref_load(usize& count) noexcept {
+#if SUS_ITERATOR_INVALIDATION_ATOMIC
+  if (!std::is_constant_evaluated()) {
+    return usize(std::atomic_ref(count.primitive_value)
+                     .load(std::memory_order_relaxed));
+  }
+#endif
+  return count;
+}
+
+}  // namespace __private
+
 /// An iterator's refcount on the owning collection, preventig mutation while
 /// the iterator is alive.
 struct [[_sus_trivial_abi]] IterRef final {
@@ -60,10 +119,10 @@ struct [[_sus_trivial_abi]] IterRef final {
   constexpr void inc() {
     // TODO: Remove this condition? Some slices have no collection so the
     // iterator doesn't either.
-    if (count_ptr_) *count_ptr_ += 1u;
+    if (count_ptr_) __private::iter_ref_add(*count_ptr_, 1u);
   }
   constexpr void dec() {
-    if (count_ptr_) *count_ptr_ -= 1u;
+    if (count_ptr_) __private::iter_ref_sub(*count_ptr_, 1u);
   }
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
@@ -104,7 +163,9 @@ struct [[_sus_trivial_abi]] IterRefCounter final {
   }
 
   /// Only valid to be called on owning collections such as Vec.
-  constexpr usize count_from_owner() const noexcept { return count; }
+  constexpr usize count_from_owner() const noexcept {
+    return __private::iter_ref_load(count);
+  }
 
   /// Resets self to no ref counts, returning a new IterRefCounter containing
   /// the old ref counts.
@@ -130,8 +191,10 @@ struct [[_sus_trivial_abi]] IterRefCounter final {
 
   union {
     /// The `count` member is active in owning collections like `Vec`.
-    // TODO: This needs to be atomic: a container can be iterated on multiple
-    // threads.
+    ///
+    /// It is only modified atomically if SUS_ITERATOR_INVALIDATION_ATOMIC is
+    /// enabled, which is required in order for a collection to be iterated on
+    /// multiple threads.
     mutable usize count;
     /// The `count_ptr` member is active in view collections like `Slice`. It
     /// points to he owning collection. The presence of a `count_ptr` must also
@@ -18,6 +18,8 @@
 
 #include "googletest/include/gtest/gtest.h"
 #include "sus/assertions/unreachable.h"
+#include "sus/boxed/box.h"
+#include "sus/choice/choice.h"
 #include "sus/cmp/eq.h"
 #include "sus/collections/array.h"
 #include "sus/collections/vec.h"
@@ -27,12 +29,15 @@
 #include "sus/iter/adaptors/filter.h"
 #include "sus/iter/empty.h"
 #include "sus/iter/into_iterator.h"
+#include "sus/iter/merge.h"
+#include "sus/iter/successors.h"
 #include "sus/iter/zip.h"
 #include "sus/macros/__private/compiler_bugs.h"
 #include "sus/mem/never_value.h"
 #include "sus/mem/replace.h"
 #include "sus/num/overflow_integer.h"
 #include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
 #include "sus/test/no_copy_move.h"
 
 using sus::collections::Array;
@@ -52,6 +57,13 @@ struct CollectRefs {
   sus::Vec<const NoCopyMove*> vec;
 };
 
+/// Records the lower bound of the iterator it was last collected from, which
+/// is the space that a collection would reserve up front.
+struct CollectReserved {
+  static inline usize reserved;
+  usize len;
+};
+
 }  // namespace sus::test::iter
 
 template <class T>
@@ -64,6 +76,16 @@ struct sus::iter::FromIteratorImpl<sus::test::iter::CollectSum<T>> {
   }
 };
 
+template <>
+struct sus::iter::FromIteratorImpl<sus::test::iter::CollectReserved> {
+  static sus::test::iter::CollectReserved from_iter(
+      sus::iter::IntoIterator<i32> auto&& into_iter) noexcept {
+    auto it = sus::move(into_iter).into_iter();
+    sus::test::iter::CollectReserved::reserved = it.size_hint().lower;
+    return sus::test::iter::CollectReserved(sus::move(it).count());
+  }
+};
+
 template <>
 struct sus::iter::FromIteratorImpl<sus::test::iter::CollectRefs> {
   static sus::test::iter::CollectRefs from_iter(
@@ -302,6 +324,110 @@ TEST(Iterator, Any) {
                     [](auto i) { return i > 4; }) == false);
 }
 
+TEST(Iterator, ArrayChunks) {
+  // Evenly divided.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6);
+    auto it = sus::move(v).into_iter().array_chunks<3>();
+    static_assert(sus::iter::Iterator<decltype(it), sus::Array<i32, 3>>);
+    static_assert(
+        sus::iter::ExactSizeIterator<decltype(it), sus::Array<i32, 3>>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 3>(1, 2, 3)));
+    EXPECT_EQ(it.exact_size_hint(), 1u);
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 3>(4, 5, 6)));
+    EXPECT_EQ(it.next(), sus::none());
+    EXPECT_EQ(sus::move(it).into_remainder().count(), 0u);
+  }
+  // With a remainder.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8);
+    auto it = v.iter().copied().array_chunks<3>();
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 3>(1, 2, 3)));
+    // The remainder is empty until the iterator is exhausted.
+    EXPECT_EQ(sus::clone(it).into_remainder().count(), 0u);
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 3>(4, 5, 6)));
+    EXPECT_EQ(it.next(), sus::none());
+    EXPECT_EQ(it.next(), sus::none());
+    EXPECT_EQ(sus::move(it).into_remainder().collect<sus::Vec<i32>>(),
+              sus::Vec<i32>(7, 8));
+  }
+  // Through an iterator without a trusted length.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7);
+    auto it = v.iter()
+                  .filter([](const i32& i) { return i != 3; })
+                  .copied()
+                  .array_chunks<2>();
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(3u)));
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 2>(1, 2)));
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 2>(4, 5)));
+    EXPECT_EQ(it.next().unwrap(), (sus::Array<i32, 2>(6, 7)));
+    EXPECT_EQ(it.next(), sus::none());
+    EXPECT_EQ(sus::move(it).into_remainder().count(), 0u);
+  }
+}
+
+TEST(Iterator, Batched) {
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7);
+    auto it = sus::move(v).into_iter().batched(3u);
+    static_assert(sus::iter::Iterator<decltype(it), sus::SliceMut<i32>>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(1, 2, 3));
+    EXPECT_EQ(it.exact_size_hint(), 2u);
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(4, 5, 6));
+    // The last batch is shorter.
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(7));
+    EXPECT_EQ(it.next(), sus::none());
+  }
+  // The same buffer is reused for each batch.
+  {
+    auto v = sus::Vec<i32>(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+    auto it = v.iter()
+                  .filter([](const i32&) { return true; })
+                  .copied()
+                  .batched(4u);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(3u)));
+    auto b1 = it.next().unwrap();
+    const i32* p = b1.as_ptr();
+    EXPECT_EQ(b1, sus::Vec<i32>(0, 1, 2, 3));
+    auto b2 = it.next().unwrap();
+    EXPECT_EQ(b2.as_ptr(), p);
+    EXPECT_EQ(b2, sus::Vec<i32>(4, 5, 6, 7));
+    auto b3 = it.next().unwrap();
+    EXPECT_EQ(b3.as_ptr(), p);
+    EXPECT_EQ(b3, sus::Vec<i32>(8, 9));
+    EXPECT_EQ(it.next(), sus::none());
+  }
+  // Elements can be moved out of the batch.
+  {
+    auto v = sus::Vec<sus::Box<i32>>();
+    for (i32 i; i < 5; i += 1) v.push(sus::Box<i32>(i));
+    auto out = sus::Vec<sus::Box<i32>>();
+    auto it = sus::move(v).into_iter().batched(2u);
+    while (true) {
+      auto batch = it.next();
+      if (batch.is_none()) break;
+      for (sus::Box<i32>& b : batch->iter_mut()) out.push(sus::move(b));
+    }
+    EXPECT_EQ(out.len(), 5u);
+    EXPECT_EQ(*out[4u], 4);
+  }
+}
+
+TEST(IteratorDeathTest, BatchedZero) {
+#if GTEST_HAS_DEATH_TEST
+  auto v = sus::Vec<i32>(1, 2, 3);
+  EXPECT_DEATH(
+      {
+        auto it = sus::move(v).into_iter().batched(0u);
+        sus::test::ensure_use(&it);
+      },
+      "");
+#endif
+}
+
 TEST(Iterator, Count) {
   {
     int nums[5] = {1, 2, 3, 4, 5};
@@ -471,6 +597,93 @@ TEST(Iterator, MapDoubleEnded) {
   EXPECT_EQ(it.next_back(), sus::None);
 }
 
+TEST(Iterator, MapFilterFusion) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6);
+  auto add = [](const i32& i) { return i + 1; };
+  auto twice = [](i32 i) { return i * 2; };
+  auto even = [](const i32& i) { return i % 2 == 0; };
+  auto big = [](const i32& i) { return i > 2; };
+
+  // A chain of `map()` is a single `Map`, which keeps the exact size and
+  // random access of the inner iterator.
+  {
+    auto it = v.iter().map(add).map(twice).map(twice);
+    static_assert(sizeof(it) == sizeof(v.iter().map(add)));
+    static_assert(sus::iter::__private::IsMap<decltype(it)>::value);
+    static_assert(sus::iter::__private::TrustedRandomAccess<decltype(it)>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), i32>);
+    EXPECT_EQ(it.exact_size_hint(), 6u);
+    EXPECT_EQ(it.next(), sus::some(8));
+    EXPECT_EQ(it.next_back(), sus::some(28));
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(12, 16, 20, 24));
+  }
+  // A chain of `filter()` is a single `Filter`.
+  {
+    auto it = v.iter().filter(even).filter(big);
+    static_assert(sizeof(it) == sizeof(v.iter().filter(even)));
+    EXPECT_EQ(it.next_back().unwrap(), 6);
+    EXPECT_EQ(sus::move(it).copied().collect_vec(), sus::Vec<i32>(4));
+  }
+  // Mixing `map()` and `filter()` produces a single `FilterMap`.
+  {
+    auto it = v.iter().map(add).filter(even).map(twice).filter(big);
+    static_assert(sizeof(it) == sizeof(v.iter().map(add)));
+    static_assert(std::same_as<decltype(it.next()), Option<i32>>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(6u)));
+    EXPECT_EQ(it.clone().next_back(), sus::some(12));
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(4, 8, 12));
+  }
+  {
+    auto it = v.iter().filter(even).map(add).map(twice);
+    EXPECT_EQ(sus::move(it).rev().collect_vec(), sus::Vec<i32>(14, 10, 6));
+  }
+  {
+    auto it = v.iter()
+                  .filter_map([](const i32& i) -> Option<i32> {
+                    if (i == 3) return sus::none();
+                    return sus::some(i);
+                  })
+                  .filter(even)
+                  .map(twice);
+    EXPECT_EQ(sus::move(it).sum(), 4 + 8 + 12);
+  }
+  // Each closure is called once for each item that reaches it, in order.
+  {
+    auto calls = sus::Vec<i32>();
+    auto it = v.iter()
+                  .map([&calls](const i32& i) {
+                    calls.push(i);
+                    return i;
+                  })
+                  .filter([&calls](const i32& i) {
+                    calls.push(-i);
+                    return i % 2 == 1;
+                  })
+                  .map([&calls](i32 i) {
+                    calls.push(i * 10);
+                    return i;
+                  });
+    EXPECT_EQ(sus::move(it).fold(0, [](i32 acc, i32 i) { return acc + i; }),
+              1 + 3 + 5);
+    EXPECT_EQ(calls, sus::Vec<i32>(1, -1, 10, 2, -2, 3, -3, 30, 4, -4, 5, -5,
+                                   50, 6, -6));
+  }
+  // References are passed through.
+  {
+    auto it = v.iter().filter(even).map(
+        [](const i32& i) -> const i32& { return i; });
+    static_assert(std::same_as<decltype(it.next()), Option<const i32&>>);
+    EXPECT_EQ(&it.next().unwrap(), &v[1u]);
+  }
+
+  static_assert(sus::Array<i32, 4>(1, 2, 3, 4)
+                    .into_iter()
+                    .map([](i32 i) { return i * 3; })
+                    .filter([](const i32& i) { return i % 2 == 0; })
+                    .map([](i32 i) { return i + 1; })
+                    .sum() == 7 + 13);
+}
+
 TEST(Iterator, MapWhile) {
   {
     auto nums = sus::Array<i32, 5>(1, 2, 3, 4, 5);
@@ -528,6 +741,70 @@ TEST(Iterator, CollectVec) {
                 sus::Vec<i32>(1, 2, 3, 4, 5));
 }
 
+TEST(Iterator, CollectInto) {
+  auto v = sus::Vec<i32>::with_capacity(8u);
+  v.push(-1);
+  const i32* const storage = v.as_ptr();
+
+  // Replaces the contents, keeping the storage.
+  {
+    Vec<i32>& r = sus::Array<i32, 3>(1, 2, 3).into_iter().collect_into(v);
+    EXPECT_EQ(&r, &v);
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3));
+    EXPECT_EQ(v.capacity(), 8u);
+    EXPECT_EQ(v.as_ptr(), storage);
+  }
+  // Without a known size.
+  {
+    sus::Vec<i32>(1, 2, 3, 4, 5, 6)
+        .into_iter()
+        .filter([](const i32& i) { return i % 2 == 0; })
+        .collect_into(v);
+    EXPECT_EQ(v, sus::Vec<i32>(2, 4, 6));
+    EXPECT_EQ(v.as_ptr(), storage);
+  }
+  // Empty.
+  {
+    sus::iter::empty<i32>().collect_into(v);
+    EXPECT_EQ(v.len(), 0u);
+    EXPECT_EQ(v.capacity(), 8u);
+  }
+  // Grows if needed.
+  {
+    sus::Array<i32, 9>(1, 2, 3, 4, 5, 6, 7, 8, 9).into_iter().collect_into(v);
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+    EXPECT_GE(v.capacity(), 9u);
+  }
+
+  static_assert([]() {
+    auto v = sus::Vec<i32>(7, 8);
+    sus::Array<i32, 3>(1, 2, 3).into_iter().collect_into(v);
+    return v == sus::Vec<i32>(1, 2, 3);
+  }());
+}
+
+TEST(Iterator, CollectVecIn) {
+  auto buffer = sus::Vec<i32>::with_capacity(8u);
+  buffer.push(-1);
+  const i32* const storage = buffer.as_ptr();
+
+  Vec<i32> v =
+      sus::Array<i32, 3>(1, 2, 3).into_iter().collect_vec_in(sus::move(buffer));
+  EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3));
+  EXPECT_EQ(v.capacity(), 8u);
+  EXPECT_EQ(v.as_ptr(), storage);
+
+  // Round trip the storage through a loop.
+  for (i32 i : sus::Array<i32, 3>(4, 5, 6)) {
+    v = sus::Array<i32, 2>(i, i + 1).into_iter().collect_vec_in(sus::move(v));
+    EXPECT_EQ(v, sus::Vec<i32>(i, i + 1));
+    EXPECT_EQ(v.as_ptr(), storage);
+  }
+
+  static_assert(sus::Array<i32, 3>(1, 2, 3).into_iter().collect_vec_in(
+                    sus::Vec<i32>(7, 8)) == sus::Vec<i32>(1, 2, 3));
+}
+
 TEST(Iterator, TryCollect) {
   // Option.
   {
@@ -618,6 +895,86 @@ TEST(Iterator, TryCollect_Example) {
   }
 }
 
+TEST(Iterator, TryCollectReserve) {
+  // Any element after the first may be a failure, so the collection only
+  // reserves for the first, and grows as the rest are found to be successes.
+  {
+    auto v = sus::Vec<Option<i32>>::with_capacity(100u);
+    for (i32 i; i < 100; i += 1) v.push(sus::some(i));
+    auto collected = sus::move(v).into_iter().try_collect<CollectReserved>();
+    EXPECT_EQ(collected.as_value().len, 100u);
+    EXPECT_EQ(CollectReserved::reserved, 1u);
+  }
+  // A failure after the first element does not waste a reservation for the
+  // whole input.
+  {
+    auto v = sus::Vec<Option<i32>>::with_capacity(100u);
+    v.push(sus::some(0));
+    v.push(sus::none());
+    for (i32 i = 2; i < 100; i += 1) v.push(sus::some(i));
+    auto collected = sus::move(v).into_iter().try_collect<CollectReserved>();
+    EXPECT_EQ(collected.is_none(), true);
+    EXPECT_EQ(CollectReserved::reserved, 1u);
+
+    auto w = sus::Vec<Option<i32>>::with_capacity(100u);
+    w.push(sus::some(0));
+    w.push(sus::none());
+    for (i32 i = 2; i < 100; i += 1) w.push(sus::some(i));
+    auto vec = sus::move(w).into_iter().try_collect<Vec<i32>>();
+    EXPECT_EQ(vec.is_none(), true);
+  }
+  // A failure in the first element is returned without collecting anything,
+  // and the iterator can continue after it.
+  {
+    usize sums;
+    auto it = sus::Array<Option<i32>, 3>(::sus::none(), ::sus::some(2),
+                                         ::sus::some(3))
+                  .into_iter()
+                  .inspect([&](const Option<i32>&) { sums += 1u; });
+    auto up_to_none = it.try_collect<CollectSum<i32>>();
+    EXPECT_EQ(up_to_none.is_none(), true);
+    EXPECT_EQ(sums, 1u);
+    EXPECT_EQ(it.try_collect<CollectSum<i32>>().unwrap().sum, 2 + 3);
+  }
+  // The error can be any type, such as a Choice.
+  {
+    enum class Tag { Parse, Range };
+    using Error = sus::Choice<sus_choice_types((Tag::Parse, std::string),
+                                               (Tag::Range, i32))>;
+    auto rows = sus::Vec<Result<i32, Error>>();
+    rows.push(sus::ok(1));
+    rows.push(sus::err(Error::with<Tag::Range>(99)));
+    rows.push(sus::err(Error::with<Tag::Parse>(std::string("x"))));
+    auto collected = sus::move(rows).into_iter().try_collect<Vec<i32>>();
+    EXPECT_EQ(collected.is_err(), true);
+    EXPECT_EQ(collected.as_err().which(), Tag::Range);
+    EXPECT_EQ(collected.as_err().as<Tag::Range>(), 99);
+
+    auto first = sus::Vec<Result<i32, Error>>();
+    first.push(sus::err(Error::with<Tag::Parse>(std::string("bad"))));
+    first.push(sus::ok(1));
+    auto failed = sus::move(first).into_iter().try_collect<Vec<i32>>();
+    EXPECT_EQ(failed.as_err().as<Tag::Parse>(), "bad");
+  }
+  // Collecting into a Result reserves nothing up front, as any element may be
+  // an Err.
+  {
+    auto v = sus::Vec<Result<i32, i32>>();
+    v.push(sus::ok(0));
+    v.push(sus::err(1));
+    for (i32 i = 2; i < 10; i += 1) v.push(sus::ok(i));
+    auto collected =
+        sus::move(v).into_iter().collect<Result<CollectReserved, i32>>();
+    EXPECT_EQ(collected.as_err(), 1);
+    EXPECT_EQ(CollectReserved::reserved, 0u);
+
+    auto w = sus::Vec<Result<i32, i32>>();
+    for (i32 i; i < 10; i += 1) w.push(sus::ok(i));
+    auto all = sus::move(w).into_iter().collect<Result<Vec<i32>, i32>>();
+    EXPECT_EQ(all.as_value().len(), 10u);
+  }
+}
+
 TEST(Iterator, Rev) {
   i32 nums[5] = {1, 2, 3, 4, 5};
 
@@ -1497,6 +1854,23 @@ TEST(Iterator, Cycle) {
     EXPECT_EQ(it.next().unwrap(), 1);
   }
 
+  // Contiguous iterators wrap an index into the original iterator.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3);
+    auto it = v.iter().copied().cycle();
+    static_assert(std::same_as<decltype(it.next()), sus::Option<i32>>);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next().unwrap(), 2);
+    auto c = it.clone();
+    EXPECT_EQ(it.next().unwrap(), 3);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(c.next().unwrap(), 3);
+    EXPECT_EQ(c.next().unwrap(), 1);
+    EXPECT_EQ(c.next().unwrap(), 2);
+    EXPECT_EQ(sus::move(it).take(7u).collect_vec(),
+              sus::Vec<i32>(2, 3, 1, 2, 3, 1, 2));
+  }
+
   // An iterator with a 0 lower bound and non-0 upper bound.
   {
     auto it = UnknownLimitIter().cycle();
@@ -1682,9 +2056,9 @@ TEST(Iterator, Flatten) {
     EXPECT_EQ(it.next().unwrap(), 4);
     EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
     EXPECT_EQ(it.next().unwrap(), 5);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next().unwrap(), 6);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, backward.
@@ -1705,11 +2079,11 @@ TEST(Iterator, Flatten) {
     EXPECT_EQ(it.next_back().unwrap(), 4);
     EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next_back().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next_back().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next_back(), sus::None);
   }
   // By value/into_iter, backward with 1 left in the first iterator, then
@@ -1722,11 +2096,11 @@ TEST(Iterator, Flatten) {
     EXPECT_EQ(it.next_back().unwrap(), 4);
     EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, backward with none left in the first iterator, then
@@ -1741,9 +2115,9 @@ TEST(Iterator, Flatten) {
     EXPECT_EQ(it.next_back().unwrap(), 3);
     EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, forward with 1 left in the first iterator, then
@@ -1756,11 +2130,11 @@ TEST(Iterator, Flatten) {
     EXPECT_EQ(it.next().unwrap(), 1);
     EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next_back().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, forward with none left in the first iterator, then
@@ -1775,9 +2149,9 @@ TEST(Iterator, Flatten) {
     EXPECT_EQ(it.next().unwrap(), 2);
     EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // iter().
@@ -1831,19 +2205,19 @@ TEST(Iterator, FlatMap) {
         Integers(1, 2), Integers(3, 4), Integers(10, 11));
     auto it = sus::move(vec).into_iter().flat_map(&Integers::make_iterable);
     static_assert(std::same_as<decltype(it.next()), Option<i32>>);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(6u, sus::some(6u)));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(5u, sus::some(5u)));
     EXPECT_EQ(it.next().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
     EXPECT_EQ(it.next().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
     EXPECT_EQ(it.next().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next().unwrap(), 10);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next().unwrap(), 11);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, backward.
@@ -1852,19 +2226,19 @@ TEST(Iterator, FlatMap) {
         Integers(1, 2), Integers(3, 4), Integers(10, 11));
     auto it = sus::move(vec).into_iter().flat_map(&Integers::make_iterable);
     static_assert(std::same_as<decltype(it.next()), Option<i32>>);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(6u, sus::some(6u)));
     EXPECT_EQ(it.next_back().unwrap(), 11);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(5u, sus::some(5u)));
     EXPECT_EQ(it.next_back().unwrap(), 10);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next_back().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next_back().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next_back(), sus::None);
   }
   // By value/into_iter, backward with 1 left in the first iterator, then
@@ -1873,15 +2247,15 @@ TEST(Iterator, FlatMap) {
     auto vec = sus::Vec<Integers>(Integers(1, 2), Integers(3, 4));
     auto it = sus::move(vec).into_iter().flat_map(&Integers::make_iterable);
     static_assert(std::same_as<decltype(it.next()), Option<i32>>);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, backward with none left in the first iterator, then
@@ -1890,15 +2264,15 @@ TEST(Iterator, FlatMap) {
     auto vec = sus::Vec<Integers>(Integers(1, 2), Integers(3, 4));
     auto it = sus::move(vec).into_iter().flat_map(&Integers::make_iterable);
     static_assert(std::same_as<decltype(it.next()), Option<i32>>);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, forward with 1 left in the first iterator, then
@@ -1907,15 +2281,15 @@ TEST(Iterator, FlatMap) {
     auto vec = sus::Vec<Integers>(Integers(1, 2), Integers(3, 4));
     auto it = sus::move(vec).into_iter().flat_map(&Integers::make_iterable);
     static_assert(std::same_as<decltype(it.next()), Option<i32>>);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next_back().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
   // By value/into_iter, forward with none left in the first iterator, then
@@ -1924,15 +2298,15 @@ TEST(Iterator, FlatMap) {
     auto vec = sus::Vec<Integers>(Integers(1, 2), Integers(3, 4));
     auto it = sus::move(vec).into_iter().flat_map(&Integers::make_iterable);
     static_assert(std::same_as<decltype(it.next()), Option<i32>>);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
     EXPECT_EQ(it.next().unwrap(), 1);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
     EXPECT_EQ(it.next().unwrap(), 2);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
     EXPECT_EQ(it.next_back().unwrap(), 4);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
     EXPECT_EQ(it.next_back().unwrap(), 3);
-    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
     EXPECT_EQ(it.next(), sus::None);
   }
 
@@ -1987,6 +2361,61 @@ TEST(Iterator, FlatMap) {
   );
 }
 
+TEST(Iterator, FlattenSizeHint) {
+  // Iterables with a size known from their type give an exact size.
+  {
+    auto arrays = sus::Vec<sus::Array<i32, 3>>(sus::Array<i32, 3>(1, 2, 3),
+                                               sus::Array<i32, 3>(4, 5, 6),
+                                               sus::Array<i32, 3>(7, 8, 9));
+    auto it = sus::move(arrays).into_iter().flatten();
+    static_assert(sus::iter::TrustedLen<decltype(it)>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(9u, sus::some(9u)));
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next_back().unwrap(), 9);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(7u, sus::some(7u)));
+
+    sus::Vec<i32> v = sus::move(it).collect_vec();
+    EXPECT_EQ(v.capacity(), 7u);
+    EXPECT_EQ(v, sus::Vec<i32>(2, 3, 4, 5, 6, 7, 8));
+  }
+  {
+    auto it = sus::Vec<i32>(1, 2).into_iter().flat_map(
+        [](i32 i) { return sus::Array<i32, 2>(i, i * 10); });
+    static_assert(sus::iter::TrustedLen<decltype(it)>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(4u)));
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(1, 10, 2, 20));
+  }
+  // Other iterables give an upper bound once the last one has been reached.
+  {
+    auto vecs = sus::Vec<Vec<i32>>(sus::Vec<i32>(1, 2), sus::Vec<i32>(3, 4));
+    auto it = sus::move(vecs).into_iter().flatten();
+    static_assert(!sus::iter::TrustedLen<decltype(it)>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::none()));
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(it.next_back().unwrap(), 4);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
+  }
+  // Iterating a slice of containers gives an exact size from their lengths.
+  {
+    auto vecs = sus::Vec<Vec<i32>>(sus::Vec<i32>(1, 2), sus::Vec<i32>(),
+                                   sus::Vec<i32>(3, 4, 5));
+    auto it = vecs.iter().flatten();
+    static_assert(sus::iter::TrustedLen<decltype(it)>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(5u, sus::some(5u)));
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next_back().unwrap(), 5);
+    EXPECT_EQ(it.exact_size_hint(), 3u);
+    EXPECT_EQ(it.find([](const i32& i) { return i == 3; }).unwrap(), 3);
+    EXPECT_EQ(it.exact_size_hint(), 1u);
+
+    sus::Vec<i32> v = sus::move(it).copied().collect_vec();
+    EXPECT_EQ(v.capacity(), 1u);
+    EXPECT_EQ(v, sus::Vec<i32>(4));
+  }
+}
+
 TEST(Iterator, Fold) {
   // Check the accumulator type can be different from the iterating type.
   {
@@ -2886,6 +3315,105 @@ TEST(Iterator, Ne) {
       sus::Vec<i32>(2, 3, 4).into_iter().ne(sus::Array<i32, 3>(2, 3, 5)));
 }
 
+TEST(Iterator, NextChunk) {
+  // Without a known length.
+  {
+    auto it = sus::Vec<i32>(1, 2, 3, 4, 5).into_iter().filter(
+        [](const i32&) { return true; });
+    static_assert(
+        std::same_as<decltype(it.next_chunk<2>()),
+                     Result<Array<i32, 2>, Array<Option<i32>, 2>>>);
+    EXPECT_EQ(it.next_chunk<2>().unwrap(), (Array<i32, 2>(1, 2)));
+    EXPECT_EQ(it.next_chunk<2>().unwrap(), (Array<i32, 2>(3, 4)));
+    EXPECT_EQ(it.next_chunk<2>().unwrap_err(),
+              (Array<Option<i32>, 2>(sus::some(5), sus::none())));
+    EXPECT_EQ(it.next_chunk<2>().unwrap_err(),
+              (Array<Option<i32>, 2>(sus::none(), sus::none())));
+  }
+  // VecIntoIter.
+  {
+    auto it = sus::Vec<i32>(1, 2, 3, 4, 5).into_iter();
+    EXPECT_EQ(it.next_chunk<3>().unwrap(), (Array<i32, 3>(1, 2, 3)));
+    EXPECT_EQ(it.next_chunk<3>().unwrap_err(),
+              (Array<Option<i32>, 3>(sus::some(4), sus::some(5), sus::none())));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = sus::Vec<i32>(1, 2, 3).into_iter();
+    EXPECT_EQ(it.next_back(), sus::some(3));
+    EXPECT_EQ(it.next_chunk<2>().unwrap(), (Array<i32, 2>(1, 2)));
+    EXPECT_EQ(it.next_chunk<2>().unwrap_err(),
+              (Array<Option<i32>, 2>(sus::none(), sus::none())));
+  }
+  // ArrayIntoIter.
+  {
+    auto it = sus::Array<i32, 5>(1, 2, 3, 4, 5).into_iter();
+    EXPECT_EQ(it.next_chunk<4>().unwrap(), (Array<i32, 4>(1, 2, 3, 4)));
+    EXPECT_EQ(it.next_chunk<4>().unwrap_err(),
+              (Array<Option<i32>, 4>(sus::some(5), sus::none(), sus::none(),
+                                     sus::none())));
+  }
+  // Copied from contiguous memory.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 5);
+    auto it = v.iter().copied();
+    EXPECT_EQ(it.next_chunk<2>().unwrap(), (Array<i32, 2>(1, 2)));
+    EXPECT_EQ(it.next(), sus::some(3));
+    EXPECT_EQ(it.next_chunk<3>().unwrap_err(),
+              (Array<Option<i32>, 3>(sus::some(4), sus::some(5), sus::none())));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  // Map over random access items calls the function once for each item.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 5);
+    i32 calls;
+    auto it = v.iter().map([&calls](const i32& i) {
+      calls += 1;
+      return i * 10;
+    });
+    EXPECT_EQ(it.next_chunk<4>().unwrap(), (Array<i32, 4>(10, 20, 30, 40)));
+    EXPECT_EQ(calls, 4);
+    EXPECT_EQ(it.size_hint().lower, 1u);
+    EXPECT_EQ(it.next_chunk<2>().unwrap_err(),
+              (Array<Option<i32>, 2>(sus::some(50), sus::none())));
+    EXPECT_EQ(calls, 5);
+  }
+  // Map over the chunks of the inner iterator.
+  {
+    i32 calls;
+    auto it = sus::Vec<i32>(1, 2, 3).into_iter().map([&calls](i32 i) {
+      calls += 1;
+      return u32::try_from(i).unwrap();
+    });
+    EXPECT_EQ(it.next_chunk<2>().unwrap(), (Array<u32, 2>(1u, 2u)));
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(it.next_chunk<2>().unwrap_err(),
+              (Array<Option<u32>, 2>(sus::some(3u), sus::none())));
+    EXPECT_EQ(calls, 3);
+  }
+  // Random access through other adaptors.
+  {
+    auto a = sus::Vec<i32>(1, 2, 3);
+    auto b = sus::Vec<i32>(4, 5, 6, 7);
+    auto it = sus::iter::zip(a.iter().copied(), b.iter().copied()).enumerate();
+    auto chunk = it.next_chunk<2>().unwrap();
+    EXPECT_EQ(chunk[0u], (sus::tuple(0u, sus::tuple(1, 4))));
+    EXPECT_EQ(chunk[1u], (sus::tuple(1u, sus::tuple(2, 5))));
+    EXPECT_EQ(it.next(), sus::some(sus::tuple(2u, sus::tuple(3, 6))));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  // More than the length of the iterator.
+  {
+    auto v = sus::Vec<i32>(1, 2);
+    auto it = v.iter().copied();
+    EXPECT_EQ(it.next_chunk<3>().unwrap_err(),
+              (Array<Option<i32>, 3>(sus::some(1), sus::some(2), sus::none())));
+  }
+
+  static_assert(sus::Array<i32, 3>(1, 2, 3).into_iter().next_chunk<2>() ==
+                sus::ok(sus::Array<i32, 2>(1, 2)));
+}
+
 TEST(Iterator, Nth) {
   {
     auto it = sus::Array<i32, 0>().into_iter();
@@ -3290,6 +3818,172 @@ TEST(Iterator, Peekable) {
   }() == 1 + 1);
 }
 
+TEST(Iterator, PeekableN) {
+  {
+    auto a = sus::Array<i32, 5>(1, 2, 3, 4, 5);
+    auto it = a.iter().peekable<3>();
+    static_assert(sus::mem::Clone<decltype(it)>);
+    static_assert(sus::mem::TriviallyRelocatable<decltype(it)>);
+    static_assert(sus::iter::Iterator<decltype(it), const i32&>);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), const i32&>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const i32&>);
+    static_assert(
+        std::same_as<decltype(it.peek_nth(0u)), sus::Option<const i32&>>);
+
+    EXPECT_EQ(it.peek_nth(2u).copied(), sus::some(3));
+    EXPECT_EQ(&it.peek_nth(1u).unwrap(), &a[1u]);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(5u, sus::some(5u)));
+    EXPECT_EQ(it.exact_size_hint(), 5u);
+    EXPECT_EQ(it.next().copied(), sus::some(1));
+    // The ring buffer wraps around.
+    EXPECT_EQ(it.peek_nth(2u).copied(), sus::some(4));
+    EXPECT_EQ(it.peek().copied(), sus::some(2));
+    EXPECT_EQ(it.exact_size_hint(), 4u);
+
+    auto c = it.clone();
+    EXPECT_EQ(it.next_back().copied(), sus::some(5));
+    // The inner iterator is empty, so the peeked elements come from the back.
+    EXPECT_EQ(it.next_back().copied(), sus::some(4));
+    EXPECT_EQ(it.next().copied(), sus::some(2));
+    EXPECT_EQ(it.next().copied(), sus::some(3));
+    EXPECT_EQ(it.next().copied(), sus::none());
+    EXPECT_EQ(it.peek_nth(0u).copied(), sus::none());
+    EXPECT_EQ(sus::move(c).copied().collect_vec(), sus::Vec<i32>(2, 3, 4, 5));
+  }
+  // Peeking past the end.
+  {
+    auto it = sus::Array<i32, 2>(1, 2).into_iter().peekable<4>();
+    EXPECT_EQ(it.peek_nth(3u).copied(), sus::none());
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
+    EXPECT_EQ(it.peek_nth(1u).copied(), sus::some(2));
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(1, 2));
+  }
+  // peek_nth_mut() and next_if().
+  {
+    auto it = sus::Array<i32, 4>(1, 2, 3, 4).into_iter().peekable<2>();
+    it.peek_nth_mut(1u).unwrap() += 10;
+    EXPECT_EQ(it.next_if_eq(2), sus::none());
+    EXPECT_EQ(it.next_if_eq(1), sus::some(1));
+    EXPECT_EQ(it.next_if([](const i32& i) { return i > 10; }), sus::some(12));
+    EXPECT_EQ(it.next_if([](const i32& i) { return i > 10; }), sus::none());
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(3, 4));
+  }
+  // A tokenizer that needs two elements of lookahead.
+  {
+    auto v = sus::Vec<char>('a', '-', '>', 'b', '-', 'c');
+    auto it = v.iter().peekable<2>();
+    auto tokens = sus::Vec<sus::Vec<char>>();
+    while (it.peek().is_some()) {
+      if (it.peek_nth(0u).copied() == sus::some('-') &&
+          it.peek_nth(1u).copied() == sus::some('>')) {
+        char first = it.next().unwrap();
+        tokens.push(sus::Vec<char>(first, it.next().unwrap()));
+      } else {
+        tokens.push(sus::Vec<char>(it.next().unwrap()));
+      }
+    }
+    EXPECT_EQ(tokens.len(), 5u);
+    EXPECT_EQ(tokens[1u], sus::Vec<char>('-', '>'));
+    EXPECT_EQ(tokens[3u], sus::Vec<char>('-'));
+  }
+  // Move-only elements.
+  {
+    auto v = sus::Vec<sus::Box<i32>>();
+    v.push(sus::Box<i32>(1));
+    v.push(sus::Box<i32>(2));
+    auto it = sus::move(v).into_iter().peekable<2>();
+    EXPECT_EQ(*it.peek_nth(1u).unwrap(), 2);
+    EXPECT_EQ(*it.next().unwrap(), 1);
+    EXPECT_EQ(*it.next().unwrap(), 2);
+    EXPECT_EQ(it.next().is_none(), true);
+  }
+}
+
+TEST(IteratorDeathTest, PeekableNOutOfBounds) {
+  auto it = sus::Array<i32, 3>(1, 2, 3).into_iter().peekable<2>();
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto o = it.peek_nth(2u);
+        sus::test::ensure_use(&o);
+      },
+      "peek_nth\\(\\)");
+  EXPECT_DEATH(
+      {
+        auto o = it.peek_nth_mut(2u);
+        sus::test::ensure_use(&o);
+      },
+      "peek_nth_mut\\(\\)");
+#endif
+}
+
+TEST(Iterator, PrefetchBy) {
+  // Prefetching what the items point to.
+  {
+    auto v = sus::Vec<sus::Box<i32>>();
+    for (i32 i : sus::ops::range(0_i32, 10_i32)) v.push(sus::Box<i32>(i));
+
+    auto seen = sus::Vec<const i32*>();
+    auto it = v.iter().prefetch_by(
+        [&seen](const sus::Box<i32>& b) -> const void* {
+          seen.push(&*b);
+          return &*b;
+        },
+        3u);
+    static_assert(
+        std::same_as<decltype(it.next()), sus::Option<const sus::Box<i32>&>>);
+    // The items before the prefetch distance are prefetched up front.
+    EXPECT_EQ(seen.len(), 3u);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(10u, sus::some(10u)));
+    EXPECT_EQ(it.exact_size_hint(), 10u);
+
+    auto sum = 0_i32;
+    for (const sus::Box<i32>& b : it) sum += *b;
+    EXPECT_EQ(sum, 45);
+    // Each item was prefetched once, in order.
+    EXPECT_EQ(seen.len(), 10u);
+    for (auto [i, p] : seen.iter().enumerate()) EXPECT_EQ(p, &*v[i]);
+  }
+  // A distance longer than the iterator.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3);
+    auto count = 0_usize;
+    auto it = v.iter().prefetch_by(
+        [&count](const i32& i) -> const void* {
+          count += 1u;
+          return &i;
+        },
+        10u);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next().unwrap(), 2);
+    EXPECT_EQ(it.next().unwrap(), 3);
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(count, 3u);
+  }
+  // A distance of 0 prefetches each item as it's yielded.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3);
+    auto count = 0_usize;
+    auto it = v.iter().prefetch_by(
+        [&count](const i32& i) -> const void* {
+          count += 1u;
+          return &i;
+        },
+        0u);
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(count, 1u);
+  }
+
+  static_assert([]() {
+    auto a = sus::Array<i32, 3>(1, 2, 3);
+    return a.iter()
+        .prefetch_by([](const i32& i) -> const void* { return &i; }, 2u)
+        .fold(0_i32, [](i32 acc, const i32& i) { return acc + i; });
+  }() == 6);
+}
+
 TEST(Iterator, Position) {
   // iter().
   {
@@ -3711,7 +4405,7 @@ TEST(Iterator, StepBy) {
   {
     auto it = sus::Array<i32, 6>(2, 3, 4, 5, 6, 7).into_iter().step_by(2u);
     EXPECT_EQ(it.exact_size_hint(), 3u);
-    EXPECT_EQ(it.next_back(), sus::some(6));
+    EXPECT_EQ(it.next_back().unwrap(), 6);
     EXPECT_EQ(it.exact_size_hint(), 2u);
     EXPECT_EQ(it.next_back(), sus::some(4));
     EXPECT_EQ(it.exact_size_hint(), 1u);
@@ -3744,7 +4438,7 @@ TEST(Iterator, StepBy) {
     EXPECT_EQ(it.exact_size_hint(), 3u);
     EXPECT_EQ(it.next(), sus::some(2));
     EXPECT_EQ(it.exact_size_hint(), 2u);
-    EXPECT_EQ(it.next_back(), sus::some(6));
+    EXPECT_EQ(it.next_back().unwrap(), 6);
     EXPECT_EQ(it.exact_size_hint(), 1u);
     EXPECT_EQ(it.next_back(), sus::some(4));
     EXPECT_EQ(it.exact_size_hint(), 0u);
@@ -3839,6 +4533,134 @@ TEST(Iterator, Sum) {
                 2.f + 3.f + 4.f);
 }
 
+TEST(Iterator, SumContiguous) {
+  // Iterating over references to primitives sums into the primitive type.
+  {
+    auto v = sus::Vec<u8>();
+    for (usize i; i < 3000u; i += 1u) v.push(u8::try_from(i % 7u).unwrap());
+    static_assert(std::same_as<decltype(v.iter().sum()), u8>);
+    EXPECT_EQ(v.iter().take(70u).sum(), 210u);
+    decltype(auto) p = v.iter().take(2u).sum();
+    static_assert(std::same_as<decltype(p), u8>);
+    EXPECT_EQ(p, 1u);
+    EXPECT_EQ(v.iter().skip(1u).take(30u).sum(), 87u);
+    EXPECT_EQ(v.iter().take(30u).copied().sum(), 85u);
+  }
+  // Sums across many blocks which don't overflow.
+  {
+    auto v = sus::Vec<i32>();
+    i32 expected;
+    for (i32 i = -5000; i < 5003; i += 1) {
+      v.push(i);
+      expected += i;
+    }
+    EXPECT_EQ(v.iter().sum(), expected);
+    EXPECT_EQ(v.iter().copied().sum(), expected);
+  }
+  {
+    auto v = sus::Vec<u64>();
+    for (usize i; i < 2049u; i += 1u) v.push(u64::MAX / 4096u);
+    EXPECT_EQ(v.iter().sum(), u64::MAX / 4096u * 2049u);
+  }
+  // Intermediate sums of a signed type may go out of range as long as the
+  // total does not, when the order of the additions is changed. Here the
+  // total stays in range when added in order.
+  {
+    auto v = sus::Vec<i64>();
+    for (usize i; i < 1500u; i += 1u) {
+      v.push(i64::MAX);
+      v.push(i64::MIN);
+    }
+    EXPECT_EQ(v.iter().sum(), -1500);
+    auto w = sus::Vec<i8>();
+    for (usize i; i < 1500u; i += 1u) {
+      w.push(i8::MAX);
+      w.push(-i8::MAX);
+    }
+    w.push(i8::MIN);
+    EXPECT_EQ(w.iter().sum(), i8::MIN);
+  }
+  // Floats.
+  {
+    auto v = sus::Vec<f32>();
+    for (usize i; i < 100u; i += 1u) v.push(0.5f);
+    decltype(auto) s = v.iter().sum();
+    static_assert(std::same_as<decltype(s), f32>);
+    EXPECT_EQ(s, 50.f);
+  }
+  // Products.
+  {
+    auto v = sus::Vec<u64>();
+    for (usize i; i < 2000u; i += 1u) v.push(1u);
+    v[1500u] = 3u;
+    EXPECT_EQ(v.iter().product(), 3u);
+    auto f = sus::Vec<f64>(2.0, 0.5, 4.0, 0.25, 8.0);
+    EXPECT_EQ(f.iter().product(), 8.0);
+  }
+}
+
+TEST(Iterator, MinMaxCountContiguous) {
+  auto v = sus::Vec<i32>();
+  for (i32 i; i < 3000; i += 1) v.push(i % 100);
+  v[1234u] = -4;
+  v[2345u] = -4;
+  v[17u] = 400;
+  v[2999u] = 400;
+
+  // The first minimum and the last maximum are returned, as for other
+  // iterators.
+  auto min = v.iter().min();
+  EXPECT_EQ(&min.as_value(), &v[1234u]);
+  auto max = v.iter().max();
+  EXPECT_EQ(&max.as_value(), &v[2999u]);
+  auto min_mut = v.iter_mut().min();
+  EXPECT_EQ(&min_mut.as_value(), &v[1234u]);
+  auto max_mut = v.iter_mut().max();
+  EXPECT_EQ(&max_mut.as_value(), &v[2999u]);
+
+  EXPECT_EQ(v.iter().skip(1235u).min().copied(), sus::some(-4));
+  EXPECT_EQ(v["0..0"_r].iter().min(), sus::none());
+  EXPECT_EQ(v["0..0"_r].iter().max(), sus::none());
+
+  EXPECT_EQ(v.iter().count(), 3000u);
+  EXPECT_EQ(v["5..10"_r].iter_mut().count(), 5u);
+}
+
+TEST(IteratorDeathTest, SumContiguousOverflow) {
+#if GTEST_HAS_DEATH_TEST
+  auto v = sus::Vec<u8>();
+  for (usize i; i < 1500u; i += 1u) v.push(0_u8);
+  v[1200u] = u8::MAX;
+  v[1300u] = 1_u8;
+  EXPECT_DEATH(
+      {
+        auto s = v.iter().sum();
+        sus::test::ensure_use(&s);
+      },
+      "");
+
+  auto w = sus::Vec<i64>();
+  for (usize i; i < 1500u; i += 1u) w.push(0);
+  w[3u] = i64::MAX;
+  w[1400u] = 1;
+  EXPECT_DEATH(
+      {
+        auto s = w.iter().sum();
+        sus::test::ensure_use(&s);
+      },
+      "");
+
+  auto p = sus::Vec<i32>();
+  for (usize i; i < 1500u; i += 1u) p.push(2);
+  EXPECT_DEATH(
+      {
+        auto s = p.iter().product();
+        sus::test::ensure_use(&s);
+      },
+      "");
+#endif
+}
+
 TEST(Iterator, Take) {
   // Take none.
   {
@@ -4140,6 +4962,142 @@ TEST(Iterator, TryRfold) {
                     }) == sus::none());
 }
 
+TEST(Iterator, FoldThroughAdaptors) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6);
+  auto digits = [](std::string acc, i32 i) {
+    return fmt::format("{}{}", acc, i);
+  };
+
+  EXPECT_EQ(v.iter().fold(std::string(), digits), "123456");
+  EXPECT_EQ(v.iter().rfold(std::string(), digits), "654321");
+  EXPECT_EQ(v.iter_mut().fold(std::string(), digits), "123456");
+  EXPECT_EQ(v.iter_mut().rfold(std::string(), digits), "654321");
+
+  auto times_ten = [](const i32& i) { return i * 10; };
+  EXPECT_EQ(v.iter().map(times_ten).fold(std::string(), digits),
+            "102030405060");
+  EXPECT_EQ(v.iter().map(times_ten).rfold(std::string(), digits),
+            "605040302010");
+
+  auto is_odd = [](const i32& i) { return i % 2 == 1; };
+  EXPECT_EQ(v.iter().filter(is_odd).fold(std::string(), digits), "135");
+  EXPECT_EQ(v.iter().filter(is_odd).rfold(std::string(), digits), "531");
+
+  auto index_digits = [](std::string acc, sus::Tuple<usize, const i32&> t) {
+    auto [i, x] = t;
+    return fmt::format("{}{}{}", acc, i, x);
+  };
+  auto e = v.iter().enumerate();
+  auto first = e.next().unwrap();
+  EXPECT_EQ(first.at<0>(), 0u);
+  auto last = e.next_back().unwrap();
+  EXPECT_EQ(last.at<0>(), 5u);
+  EXPECT_EQ(e.clone().fold(std::string(), index_digits), "12233445");
+  EXPECT_EQ(sus::move(e).rfold(std::string(), index_digits), "45342312");
+
+  auto w = sus::Vec<i32>(7, 8);
+  EXPECT_EQ(v.iter().chain(w.iter()).fold(std::string(), digits), "12345678");
+  EXPECT_EQ(v.iter().chain(w.iter()).rfold(std::string(), digits),
+            "87654321");
+  auto c = v.iter().chain(w.iter());
+  EXPECT_EQ(c.next().unwrap(), 1);
+  EXPECT_EQ(sus::move(c).fold(std::string(), digits), "2345678");
+
+  auto vv = sus::Vec<sus::Vec<i32>>(sus::Vec<i32>(1, 2), sus::Vec<i32>(),
+                                    sus::Vec<i32>(3, 4, 5), sus::Vec<i32>(6));
+  EXPECT_EQ(vv.clone().into_iter().flatten().fold(std::string(), digits),
+            "123456");
+  EXPECT_EQ(vv.clone().into_iter().flatten().rfold(std::string(), digits),
+            "654321");
+  auto f = vv.clone().into_iter().flatten();
+  EXPECT_EQ(f.next().unwrap(), 1);
+  EXPECT_EQ(f.next_back().unwrap(), 6);
+  EXPECT_EQ(sus::move(f).fold(std::string(), digits), "2345");
+
+  EXPECT_EQ(v.iter().copied().fold(std::string(), digits), "123456");
+  EXPECT_EQ(v.iter().cloned().rfold(std::string(), digits), "654321");
+
+  // A reference accumulator through adaptors.
+  i32 init;
+  i32& out = v.iter_mut()
+                 .map([](i32& i) -> i32& { return i; })
+                 .filter([](const i32& i) { return i % 2 == 1; })
+                 .fold<i32&>(init, [](i32&, i32& i) -> i32& { return i; });
+  EXPECT_EQ(&out, &v[4u]);
+
+  // Terminal operations built on fold().
+  EXPECT_EQ(v.iter().filter(is_odd).count(), 3u);
+  EXPECT_EQ(v.iter().map(times_ten).sum(), 210);
+  auto sum = 0_i32;
+  v.iter().chain(w.iter()).for_each([&](const i32& i) { sum += i; });
+  EXPECT_EQ(sum, 36);
+}
+
+TEST(Iterator, TryFoldThroughAdaptors) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6);
+  // Sums the items until one is larger than `limit`.
+  auto sum_until = [](i32 limit) {
+    return [limit](i32 acc, i32 i) -> Option<i32> {
+      if (i > limit) return sus::none();
+      return sus::some(acc + i);
+    };
+  };
+
+  {
+    auto it = v.iter();
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(3)), sus::none());
+    EXPECT_EQ(it.next().unwrap(), 5);
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(10)), sus::some(6));
+    EXPECT_EQ(it.next(), sus::none());
+  }
+  {
+    auto it = v.iter().map([](const i32& i) { return i * 2; });
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(4)), sus::none());
+    EXPECT_EQ(it.next().unwrap(), 8);
+  }
+  {
+    auto it = v.iter().filter([](const i32& i) { return i % 2 == 0; });
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(3)), sus::none());
+    EXPECT_EQ(it.next().unwrap(), 6);
+  }
+  {
+    auto it = v.iter().enumerate();
+    auto f = [](usize acc, sus::Tuple<usize, const i32&> t) -> Option<usize> {
+      if (t.at<1>() == 3) return sus::none();
+      return sus::some(acc + t.at<0>());
+    };
+    EXPECT_EQ(it.try_fold(0_usize, f), sus::none());
+    auto [i, x] = it.next().unwrap();
+    EXPECT_EQ(i, 3u);
+    EXPECT_EQ(x, 4);
+    EXPECT_EQ(it.try_fold(0_usize, f), sus::some(4u + 5u));
+  }
+  {
+    auto w = sus::Vec<i32>(7, 8);
+    auto it = v.iter().chain(w.iter());
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(6)), sus::none());
+    EXPECT_EQ(it.next().unwrap(), 8);
+    EXPECT_EQ(it.next(), sus::none());
+    auto it2 = v.iter().chain(w.iter());
+    EXPECT_EQ(it2.try_fold(0_i32, sum_until(10)), sus::some(36));
+  }
+  {
+    auto vv = sus::Vec<sus::Vec<i32>>(sus::Vec<i32>(1, 2), sus::Vec<i32>(),
+                                      sus::Vec<i32>(3, 4, 5), sus::Vec<i32>(6));
+    auto it = sus::move(vv).into_iter().flatten();
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(3)), sus::none());
+    // The rest of the inner iterator where the fold stopped is kept.
+    EXPECT_EQ(it.next().unwrap(), 5);
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(10)), sus::some(6));
+    EXPECT_EQ(it.next(), sus::none());
+  }
+  {
+    auto it = v.iter().copied();
+    EXPECT_EQ(it.try_fold(0_i32, sum_until(2)), sus::none());
+    EXPECT_EQ(it.next().unwrap(), 4);
+  }
+}
+
 TEST(Iterator, TryForEach) {
   struct Void {};
 
@@ -4368,6 +5326,81 @@ TEST(Iterator, Zip_Example) {
   sus_check(it.next() == sus::none());
 }
 
+TEST(Iterator, ZipRandomAccess) {
+  using sus::iter::__private::TrustedRandomAccess;
+  auto a = sus::Vec<i32>(1, 2, 3, 4, 5);
+  auto b = sus::Vec<i32>(10, 20, 30);
+
+  static_assert(TrustedRandomAccess<decltype(a.iter())>);
+  static_assert(TrustedRandomAccess<decltype(a.iter_mut())>);
+  static_assert(TrustedRandomAccess<decltype(a.iter().copied())>);
+  static_assert(TrustedRandomAccess<decltype(a.iter().cloned())>);
+  static_assert(TrustedRandomAccess<decltype(a.iter().enumerate())>);
+  static_assert(
+      TrustedRandomAccess<decltype(a.iter().map([](const i32& i) { return i; }))>);
+  static_assert(TrustedRandomAccess<decltype(a.iter().zip(b.iter()))>);
+  static_assert(!TrustedRandomAccess<decltype(a.clone().into_iter())>);
+  static_assert(!TrustedRandomAccess<decltype(a.iter().zip(
+                    a.clone().into_iter()))>);
+
+  // Ends with the shorter iterator.
+  {
+    auto it = sus::iter::zip(a.iter(), b.iter());
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
+    auto [a1, b1] = it.next().unwrap();
+    EXPECT_EQ(a1, 1);
+    EXPECT_EQ(b1, 10);
+    EXPECT_EQ(it.exact_size_hint(), 2u);
+    auto c = it.clone();
+    auto products = sus::move(it).map([](auto t) {
+      auto [x, y] = t;
+      return x * y;
+    });
+    EXPECT_EQ(sus::move(products).sum(), 2 * 20 + 3 * 30);
+    EXPECT_EQ(sus::move(c).count(), 2u);
+  }
+  // The extra item of the longer iterator is not produced by the indexed
+  // path, so its map() function does not run.
+  {
+    usize calls;
+    auto it = a.iter()
+                  .map([&calls](const i32& i) {
+                    calls += 1u;
+                    return i;
+                  })
+                  .zip(b.iter());
+    EXPECT_EQ(sus::move(it).count(), 3u);
+    EXPECT_EQ(calls, 3u);
+  }
+  // Folds from where `next()` left off.
+  {
+    auto it = b.iter().enumerate().zip(a.iter().copied());
+    it.next();
+    auto s = sus::move(it).fold(0_i32, [](i32 acc, auto t) {
+      auto [e, x] = sus::move(t);
+      auto [i, y] = sus::move(e);
+      return acc + i32::try_from(i).unwrap() * 100 + y * x;
+    });
+    EXPECT_EQ(s, 100 + 20 * 2 + 200 + 30 * 3);
+  }
+  // Mutable access by index.
+  {
+    for (auto [x, y] : a.iter_mut().zip(b.iter())) x += y;
+    EXPECT_EQ(a, sus::Vec<i32>(11, 22, 33, 4, 5));
+  }
+  // Zips of zips.
+  {
+    auto it = a.iter().zip(b.iter()).zip(b.iter().copied());
+    EXPECT_EQ(sus::move(it).fold(0_i32,
+                                 [](i32 acc, auto t) {
+                                   auto [ab, c] = sus::move(t);
+                                   auto [x, y] = sus::move(ab);
+                                   return acc + x + y + c;
+                                 }),
+              11 + 22 + 33 + 2 * (10 + 20 + 30));
+  }
+}
+
 TEST(Iterator, IsSorted) {
   EXPECT_EQ((sus::Array<i32, 0>().into_iter().is_sorted()), true);
   EXPECT_EQ(sus::Slice<i32>::from({5}).into_iter().is_sorted(), true);
@@ -4431,4 +5464,443 @@ TEST(Iterator, IsSortedBy) {
       false);
 }
 
+
+TEST(Iterator, Merge) {
+  {
+    auto a = sus::Vec<i32>(1, 3, 5, 7);
+    auto b = sus::Vec<i32>(2, 3, 4);
+    auto it = a.iter().merge(b.iter());
+    static_assert(sus::iter::Iterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(7u, sus::some(7u)));
+    EXPECT_EQ(it.next().copied(), sus::some(1));
+    auto c = it.clone();
+    auto v = sus::move(it).copied().collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(2, 3, 3, 4, 5, 7));
+    EXPECT_EQ(sus::move(c).copied().collect_vec(), v);
+  }
+  // Either side can be empty.
+  {
+    auto a = sus::Vec<i32>(1, 2);
+    auto b = sus::Vec<i32>();
+    EXPECT_EQ(a.iter().merge(b.iter()).copied().collect_vec(),
+              sus::Vec<i32>(1, 2));
+    EXPECT_EQ(b.iter().merge(a.iter()).copied().collect_vec(),
+              sus::Vec<i32>(1, 2));
+  }
+  // The merge is stable: equal elements come from the first iterator first.
+  {
+    using Pair = sus::Tuple<i32, i32>;
+    auto a = sus::Vec<Pair>(Pair(1, 0), Pair(2, 0), Pair(2, 0));
+    auto b = sus::Vec<Pair>(Pair(2, 1), Pair(3, 1));
+    auto v = sus::move(a)
+                 .into_iter()
+                 .merge_by(sus::move(b),
+                           [](const Pair& l, const Pair& r) {
+                             return l.at<0>() <=> r.at<0>();
+                           })
+                 .map([](Pair p) { return p.at<1>(); })
+                 .collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(0, 0, 0, 1, 1));
+  }
+  // Descending order with merge_by().
+  {
+    auto a = sus::Vec<i32>(9, 5, 1);
+    auto b = sus::Vec<i32>(8, 2);
+    auto v = sus::move(a)
+                 .into_iter()
+                 .merge_by(sus::move(b), [](const i32& l, const i32& r) {
+                   return r <=> l;
+                 })
+                 .collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(9, 8, 5, 2, 1));
+  }
+  // Move-only elements.
+  {
+    auto a = sus::Vec<sus::Box<i32>>();
+    a.push(sus::Box<i32>(1));
+    a.push(sus::Box<i32>(4));
+    auto b = sus::Vec<sus::Box<i32>>();
+    b.push(sus::Box<i32>(2));
+    auto v = sus::move(a)
+                 .into_iter()
+                 .merge_by(sus::move(b),
+                           [](const sus::Box<i32>& l, const sus::Box<i32>& r) {
+                             return *l <=> *r;
+                           })
+                 .map([](sus::Box<i32> b) { return *b; })
+                 .collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 4));
+  }
+  // The free function.
+  {
+    auto v = sus::iter::merge(sus::Vec<i32>(1, 3, 5), sus::Vec<i32>(2, 3, 4))
+                 .collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3, 3, 4, 5));
+  }
+}
+
+TEST(Iterator, KMerge) {
+  {
+    auto runs = sus::Vec<sus::Vec<i32>>();
+    runs.push(sus::Vec<i32>(1, 4, 7, 10));
+    runs.push(sus::Vec<i32>());
+    runs.push(sus::Vec<i32>(2, 5, 8));
+    runs.push(sus::Vec<i32>(3, 6, 9));
+    runs.push(sus::Vec<i32>(0, 11));
+    auto it = sus::move(runs).into_iter().kmerge();
+    static_assert(sus::iter::Iterator<decltype(it), i32>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(12u, sus::some(12u)));
+    EXPECT_EQ(it.next(), sus::some(0));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(11u, sus::some(11u)));
+    auto v = sus::move(it).collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+  }
+  // Merging iterators over references.
+  {
+    auto a = sus::Vec<i32>(3, 3, 5);
+    auto b = sus::Vec<i32>(1, 3, 6);
+    auto c = sus::Vec<i32>(2);
+    auto iters = sus::Vec<sus::collections::SliceIter<const i32&>>();
+    iters.push(a.iter());
+    iters.push(b.iter());
+    iters.push(c.iter());
+    auto it = sus::move(iters).into_iter().kmerge();
+    static_assert(sus::iter::Iterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.next().copied(), sus::some(1));
+    auto cl = it.clone();
+    EXPECT_EQ(sus::move(it).copied().collect_vec(),
+              sus::Vec<i32>(2, 3, 3, 3, 5, 6));
+    EXPECT_EQ(sus::move(cl).copied().collect_vec(),
+              sus::Vec<i32>(2, 3, 3, 3, 5, 6));
+  }
+  // Descending order with kmerge_by().
+  {
+    auto runs = sus::Vec<sus::Vec<i32>>();
+    runs.push(sus::Vec<i32>(9, 3));
+    runs.push(sus::Vec<i32>(8, 7, 1));
+    runs.push(sus::Vec<i32>(5));
+    auto v = sus::move(runs)
+                 .into_iter()
+                 .kmerge_by([](const i32& l, const i32& r) { return r <=> l; })
+                 .collect_vec();
+    EXPECT_EQ(v, sus::Vec<i32>(9, 8, 7, 5, 3, 1));
+  }
+  // Nothing to merge.
+  {
+    auto runs = sus::Vec<sus::Vec<i32>>();
+    auto it = sus::iter::kmerge(sus::move(runs));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+    EXPECT_EQ(it.next(), sus::none());
+  }
+  // Many runs.
+  {
+    auto runs = sus::Vec<sus::Vec<i32>>();
+    for (i32 r; r < 37; r += 1) {
+      auto run = sus::Vec<i32>();
+      for (i32 i = r; i < 1000; i += 37 + r % 3) run.push(i);
+      runs.push(sus::move(run));
+    }
+    auto expected = sus::Vec<i32>();
+    for (const sus::Vec<i32>& run : runs) expected.extend(run.iter().copied());
+    expected.sort();
+    auto v = sus::iter::kmerge(sus::move(runs)).collect_vec();
+    EXPECT_EQ(v, expected);
+  }
+}
+
+TEST(Iterator, MergeJoinBy) {
+  auto a = sus::Vec<i32>(1, 2, 4, 6);
+  auto b = sus::Vec<u32>(2u, 3u, 6u, 7u);
+  auto it = a.iter().merge_join_by(b.iter(), [](const i32& l, const u32& r) {
+    return l <=> sus::cast<i32>(r);
+  });
+  using Item = sus::Tuple<Option<const i32&>, Option<const u32&>>;
+  static_assert(sus::iter::Iterator<decltype(it), Item>);
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(4u, sus::some(8u)));
+
+  auto expect = [&](Option<i32> l, Option<u32> r) {
+    Item i = it.next().unwrap();
+    EXPECT_EQ(i.at<0>().copied(), l);
+    EXPECT_EQ(i.at<1>().copied(), r);
+  };
+  expect(sus::some(1), sus::none());
+  expect(sus::some(2), sus::some(2u));
+  expect(sus::none(), sus::some(3u));
+  expect(sus::some(4), sus::none());
+  expect(sus::some(6), sus::some(6u));
+  EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
+  expect(sus::none(), sus::some(7u));
+  EXPECT_EQ(it.next(), sus::none());
+}
+
+TEST(Iterator, SortedSetOps) {
+  auto a = sus::Vec<i32>(1, 2, 2, 2, 4, 5, 7);
+  auto b = sus::Vec<i32>(2, 2, 3, 5, 6, 8);
+
+  auto u = a.iter().sorted_union(b.iter());
+  static_assert(sus::iter::Iterator<decltype(u), const i32&>);
+  EXPECT_EQ(u.size_hint(), sus::iter::SizeHint(7u, sus::some(13u)));
+  EXPECT_EQ(sus::move(u).copied().collect_vec(),
+            sus::Vec<i32>(1, 2, 2, 2, 3, 4, 5, 6, 7, 8));
+
+  auto i = a.iter().sorted_intersection(b.iter());
+  static_assert(sus::iter::Iterator<decltype(i), const i32&>);
+  EXPECT_EQ(i.size_hint(), sus::iter::SizeHint(0u, sus::some(6u)));
+  EXPECT_EQ(sus::move(i).copied().collect_vec(), sus::Vec<i32>(2, 2, 5));
+
+  auto d = a.iter().sorted_difference(b.iter());
+  static_assert(sus::iter::Iterator<decltype(d), const i32&>);
+  EXPECT_EQ(d.size_hint(), sus::iter::SizeHint(0u, sus::some(7u)));
+  EXPECT_EQ(sus::move(d).copied().collect_vec(), sus::Vec<i32>(1, 2, 4, 7));
+  EXPECT_EQ(b.iter().sorted_difference(a.iter()).copied().collect_vec(),
+            sus::Vec<i32>(3, 6, 8));
+
+  // With an empty side.
+  auto e = sus::Vec<i32>();
+  EXPECT_EQ(a.iter().sorted_union(e.iter()).copied().collect_vec(), a);
+  EXPECT_EQ(e.iter().sorted_union(a.iter()).copied().collect_vec(), a);
+  EXPECT_EQ(a.iter().sorted_intersection(e.iter()).next(), sus::none());
+  EXPECT_EQ(e.iter().sorted_intersection(a.iter()).next(), sus::none());
+  EXPECT_EQ(a.iter().sorted_difference(e.iter()).copied().collect_vec(), a);
+  EXPECT_EQ(e.iter().sorted_difference(a.iter()).next(), sus::none());
+}
+
+TEST(Iterator, SortedSetOpsSizeHintOverflow) {
+  // Counts up from 1 without ever reaching the end of its `SizeHint`.
+  struct Counter final : public IteratorBase<Counter, i32> {
+    using Item = i32;
+    constexpr Option<Item> next() noexcept {
+      n_ += 1;
+      return Option<Item>(n_);
+    }
+    constexpr sus::iter::SizeHint size_hint() const noexcept {
+      return {0u, sus::some(usize::MAX)};
+    }
+
+    i32 n_;
+  };
+  static_assert(sus::iter::Iterator<Counter, i32>);
+
+  // The first iterator holds a peeked element, so it has one more than its
+  // upper bound left, which does not fit in a `usize`.
+  {
+    auto b = sus::Vec<i32>(0);
+    auto it = Counter().sorted_intersection(b.iter().copied());
+    EXPECT_EQ(it.next(), sus::none());
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+  }
+  {
+    auto b = sus::Vec<i32>(5);
+    auto it = Counter().sorted_union(b.iter().copied());
+    EXPECT_EQ(it.next(), sus::some(1));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+  }
+  {
+    auto b = sus::Vec<i32>(5);
+    auto it = Counter().merge(b.iter().copied());
+    EXPECT_EQ(it.next(), sus::some(1));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+  }
+  {
+    auto b = sus::Vec<i32>(5);
+    auto it = Counter().sorted_difference(b.iter().copied());
+    EXPECT_EQ(it.next(), sus::some(1));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(usize::MAX)));
+  }
+}
+
+TEST(Iterator, ChunkBy) {
+  struct Event {
+    i32 time;
+    i32 value;
+  };
+  auto events = sus::Vec<Event>(Event(1, 10), Event(1, 20), Event(2, 5),
+                                Event(4, 1), Event(4, 2), Event(4, 3));
+  auto it =
+      events.iter().chunk_by([](const Event& e) -> i32 { return e.time; });
+  auto sums = sus::Vec<sus::Tuple<i32, i32>>();
+  for (auto group : it) {
+    i32 key = group.key();
+    i32 sum = sus::move(group).fold(
+        0_i32, [](i32 acc, const Event& e) { return acc + e.value; });
+    sums.push(sus::tuple(key, sum));
+  }
+  EXPECT_EQ(sums, (sus::Vec<sus::Tuple<i32, i32>>(
+                      sus::tuple(1, 30), sus::tuple(2, 5), sus::tuple(4, 6))));
+
+  // Skipping over a group, or the end of one.
+  {
+    auto v = sus::Vec<i32>(1, 1, 2, 2, 2, 3, 1);
+    auto cit = v.iter().copied().chunk_by([](const i32& i) { return i; });
+    auto g1 = cit.next().unwrap();
+    EXPECT_EQ(g1.key(), 1);
+    auto g2 = cit.next().unwrap();
+    // The first group ended when the iterator moved on.
+    EXPECT_EQ(g1.next(), sus::none());
+    EXPECT_EQ(g2.key(), 2);
+    EXPECT_EQ(g2.next(), sus::some(2));
+    auto g3 = cit.next().unwrap();
+    EXPECT_EQ(g3.key(), 3);
+    EXPECT_EQ(g2.next(), sus::none());
+    EXPECT_EQ(sus::move(g3).collect_vec(), sus::Vec<i32>(3));
+    auto g4 = cit.next().unwrap();
+    EXPECT_EQ(g4.key(), 1);
+    EXPECT_EQ(g4.next(), sus::some(1));
+    EXPECT_EQ(g4.next(), sus::none());
+    EXPECT_EQ(cit.next().is_none(), true);
+    EXPECT_EQ(cit.next().is_none(), true);
+  }
+  // Empty.
+  {
+    auto v = sus::Vec<i32>();
+    auto cit = v.iter().chunk_by([](const i32& i) { return i; });
+    EXPECT_EQ(cit.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+    EXPECT_EQ(cit.next().is_none(), true);
+  }
+}
+
+TEST(Iterator, Dedup) {
+  {
+    auto v = sus::Vec<i32>(1, 1, 2, 3, 3, 3, 1, 4, 4);
+    auto it = v.iter().dedup();
+    static_assert(sus::iter::Iterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(9u)));
+    EXPECT_EQ(it.next().copied(), sus::some(1));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(7u)));
+    auto c = it.clone();
+    EXPECT_EQ(sus::move(it).copied().collect_vec(), sus::Vec<i32>(2, 3, 1, 4));
+    EXPECT_EQ(sus::move(c).copied().collect_vec(), sus::Vec<i32>(2, 3, 1, 4));
+  }
+  // The first of each run is kept.
+  {
+    auto v = sus::Vec<sus::Tuple<i32, i32>>(
+        sus::tuple(1, 0), sus::tuple(1, 1), sus::tuple(2, 2), sus::tuple(2, 3));
+    auto out = sus::move(v)
+                   .into_iter()
+                   .dedup_by_key([](const sus::Tuple<i32, i32>& t) {
+                     return t.at<0>();
+                   })
+                   .collect_vec();
+    EXPECT_EQ(out, (sus::Vec<sus::Tuple<i32, i32>>(sus::tuple(1, 0),
+                                                   sus::tuple(2, 2))));
+  }
+  // dedup_by_key() computes the key of each element once.
+  {
+    auto v = sus::Vec<i32>(1, 1, 2, 3, 3, 3, 1, 4, 4);
+    usize calls;
+    auto it = v.iter().dedup_by_key([&calls](const i32& i) {
+      calls += 1u;
+      return i / 2;
+    });
+    static_assert(sus::iter::Iterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.next().copied(), sus::some(1));
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::some(7u)));
+    auto c = it.clone();
+    EXPECT_EQ(sus::move(it).copied().collect_vec(), sus::Vec<i32>(2, 1, 4));
+    EXPECT_EQ(calls, 9u);
+    EXPECT_EQ(sus::move(c).copied().collect_vec(), sus::Vec<i32>(2, 1, 4));
+    EXPECT_EQ(calls, 15u);
+  }
+  // dedup_by() compares to the last element that was kept.
+  {
+    auto v = sus::Vec<i32>(1, 2, 3, 4, 7, 8, 9, 20);
+    auto out =
+        sus::move(v)
+            .into_iter()
+            .dedup_by([](const i32& a, const i32& b) { return b - a < 3; })
+            .collect_vec();
+    EXPECT_EQ(out, sus::Vec<i32>(1, 4, 7, 20));
+  }
+  // Move-only elements.
+  {
+    auto v = sus::Vec<sus::Box<i32>>();
+    v.push(sus::Box<i32>(1));
+    v.push(sus::Box<i32>(1));
+    v.push(sus::Box<i32>(2));
+    auto out = sus::move(v)
+                   .into_iter()
+                   .dedup_by_key([](const sus::Box<i32>& b) { return *b; })
+                   .map([](sus::Box<i32> b) { return *b; })
+                   .collect_vec();
+    EXPECT_EQ(out, sus::Vec<i32>(1, 2));
+  }
+  // Empty.
+  EXPECT_EQ(sus::Vec<i32>().into_iter().dedup().next(), sus::none());
+}
+TEST(Iterator, KSmallest) {
+  auto v = sus::Vec<i32>(5, 8, 1, 9, 3, 7, 3, 2);
+  {
+    auto it = v.iter().k_smallest(3u);
+    static_assert(sus::iter::Iterator<decltype(it), const i32&>);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
+    EXPECT_EQ(sus::move(it).copied().collect_vec(), sus::Vec<i32>(1, 2, 3));
+  }
+  // The references are to the original elements.
+  EXPECT_EQ(&v.iter().k_smallest(1u).next().unwrap(), &v[2u]);
+  EXPECT_EQ(v.iter().k_largest(3u).copied().collect_vec(),
+            sus::Vec<i32>(9, 8, 7));
+  // Fewer elements than `k`.
+  EXPECT_EQ(v.iter().copied().k_smallest(100u).collect_vec(),
+            sus::Vec<i32>(1, 2, 3, 3, 5, 7, 8, 9));
+  EXPECT_EQ(v.iter().copied().k_largest(0u).count(), 0u);
+  EXPECT_EQ(sus::Vec<i32>().into_iter().k_smallest(2u).count(), 0u);
+  // A large `k` for a short iterator without an upper bound does not reserve
+  // space for `k` elements.
+  {
+    auto it = sus::iter::successors(
+        Option<i32>(5), [](const i32& i) -> Option<i32> {
+          if (i > 1) return sus::some(i - 1);
+          return sus::none();
+        });
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(1u, sus::none()));
+    EXPECT_EQ(sus::move(it).k_smallest(usize::MAX).collect_vec(),
+              sus::Vec<i32>(1, 2, 3, 4, 5));
+  }
+
+  // By a comparison function, and by key.
+  EXPECT_EQ(v.iter()
+                .copied()
+                .k_smallest_by(2u, [](const i32& a, const i32& b) {
+                  return (a % 4) <=> (b % 4);
+                })
+                .map([](i32 i) { return i % 4; })
+                .collect_vec(),
+            sus::Vec<i32>(0, 1));
+  EXPECT_EQ(v.iter()
+                .copied()
+                .k_largest_by(2u, [](const i32& a, const i32& b) {
+                  return b <=> a;
+                })
+                .collect_vec(),
+            sus::Vec<i32>(1, 2));
+
+  struct Score {
+    i32 points;
+    i32 id;
+  };
+  auto scores = sus::Vec<Score>(Score(10, 1), Score(30, 2), Score(20, 3),
+                                Score(50, 4), Score(40, 5));
+  EXPECT_EQ(scores.iter()
+                .k_largest_by_key(3u, [](const Score& s) { return s.points; })
+                .map([](const Score& s) { return s.id; })
+                .collect_vec(),
+            sus::Vec<i32>(4, 5, 2));
+  EXPECT_EQ(scores.iter()
+                .k_smallest_by_key(2u, [](const Score& s) { return s.points; })
+                .map([](const Score& s) { return s.id; })
+                .collect_vec(),
+            sus::Vec<i32>(1, 3));
+
+  // Move-only elements.
+  auto boxes = sus::Vec<sus::Box<i32>>();
+  for (i32 i : sus::Array<i32, 5>(4, 2, 5, 1, 3)) boxes.push(sus::Box<i32>(i));
+  EXPECT_EQ(sus::move(boxes)
+                .into_iter()
+                .k_largest_by_key(2u, [](const sus::Box<i32>& b) { return *b; })
+                .map([](sus::Box<i32> b) { return *b; })
+                .collect_vec(),
+            sus::Vec<i32>(5, 4));
+}
+
 }  // namespace
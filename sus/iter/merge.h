@@ -0,0 +1,73 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "sus/cmp/ord.h"
+#include "sus/iter/into_iterator.h"
+#include "sus/iter/iterator.h"
+#include "sus/mem/move.h"
+
+namespace sus::iter {
+
+/// Converts the arguments to iterators and merges them, where both are
+/// sorted, into a single sorted iterator.
+///
+/// See the documentation of [`Iterator::merge`](
+/// $sus::iter::IteratorBase::merge) for more.
+///
+/// # Example
+/// ```
+/// auto a = sus::Vec<i32>(1, 3, 5);
+/// auto b = sus::Vec<i32>(2, 3, 4);
+/// auto v = sus::iter::merge(sus::move(a), sus::move(b)).collect_vec();
+/// sus_check(v == sus::Vec<i32>(1, 2, 3, 3, 4, 5));
+/// ```
+inline constexpr auto merge(IntoIteratorAny auto&& iia,
+                            IntoIteratorAny auto&& iib) noexcept
+    -> Iterator<typename IntoIteratorOutputType<decltype(iia)>::Item> auto
+  requires(::sus::mem::IsMoveRef<decltype(iia)> &&
+           ::sus::mem::IsMoveRef<decltype(iib)> &&
+           ::sus::cmp::Ord<
+               typename IntoIteratorOutputType<decltype(iia)>::Item>)
+{
+  return ::sus::move(iia).into_iter().merge(::sus::move(iib));
+}
+
+/// Converts the argument to an iterator over sorted iterators, and merges them
+/// into a single sorted iterator.
+///
+/// This is useful to merge a collection of sorted runs, such as a
+/// `Vec<Vec<T>>` where each inner `Vec` is sorted.
+///
+/// See the documentation of [`Iterator::kmerge`](
+/// $sus::iter::IteratorBase::kmerge) for more.
+///
+/// # Example
+/// ```
+/// auto runs = sus::Vec<sus::Vec<i32>>();
+/// runs.push(sus::Vec<i32>(1, 4, 7));
+/// runs.push(sus::Vec<i32>(2, 5, 8));
+/// runs.push(sus::Vec<i32>(3, 6, 9));
+/// auto v = sus::iter::kmerge(sus::move(runs)).collect_vec();
+/// sus_check(v == sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+/// ```
+template <IntoIteratorAny Iterables>
+  requires(::sus::mem::IsMoveRef<Iterables &&> &&
+           IntoIteratorAny<typename IntoIteratorOutputType<Iterables>::Item>)
+inline constexpr auto kmerge(Iterables&& iia) noexcept {
+  return ::sus::move(iia).into_iter().kmerge();
+}
+
+}  // namespace sus::iter
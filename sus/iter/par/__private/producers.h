@@ -0,0 +1,366 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/par/par_iter.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include "sus/collections/slice.h"
+#include "sus/collections/vec.h"
+#include "sus/construct/cast.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/iterator_ref.h"
+#include "sus/iter/once.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/ops/range.h"
+#include "sus/tuple/tuple.h"
+
+// A `ParIter` is built on top of a "source", which is consumed by a call to
+// `with_producer(callback)`. The source passes a "producer" to the callback,
+// which is valid for the duration of the call. The producer is then split
+// recursively and each piece of it is iterated on a different thread.
+//
+// A producer type `P` provides:
+// * `using Item`: The type of the items produced.
+// * `usize len() const`: The number of items in the producer before any
+//   filtering, which is used to decide how to split the work.
+// * `Tuple<P, P> split_at(usize index) &&`: Splits the producer into two
+//   producers, the first of which holds the first `index` items.
+// * `Iterator<Item> auto into_iter() &&`: Returns a sequential iterator over
+//   the producer's items.
+//
+// Producers are shared between threads so they may only hold pointers to state
+// that is owned by the source and that is not modified during iteration.
+
+namespace sus::iter::par::__private {
+
+template <class P>
+concept Producer = requires(const P& p, P&& m, usize i) {
+  typename P::Item;
+  { p.len() } -> std::same_as<usize>;
+  { ::sus::move(m).split_at(i) } -> std::same_as<::sus::Tuple<P, P>>;
+  { ::sus::move(m).into_iter() } -> ::sus::iter::Iterator<typename P::Item>;
+};
+
+/// A producer of const references to the elements of a slice.
+template <class T>
+class SliceProducer final {
+ public:
+  using Item = const T&;
+
+  constexpr SliceProducer(const T* ptr, usize len) noexcept
+      : ptr_(ptr), len_(len) {}
+
+  constexpr usize len() const noexcept { return len_; }
+  constexpr ::sus::Tuple<SliceProducer, SliceProducer> split_at(
+      usize index) && noexcept {
+    return ::sus::Tuple<SliceProducer, SliceProducer>(
+        SliceProducer(ptr_, index), SliceProducer(ptr_ + index, len_ - index));
+  }
+  constexpr ::sus::iter::Iterator<Item> auto into_iter() && noexcept {
+    return ::sus::collections::Slice<T>::from_raw_parts(
+               ::sus::marker::unsafe_fn, ptr_, len_)
+        .iter();
+  }
+
+ private:
+  const T* ptr_;
+  usize len_;
+};
+
+/// The source for [`Slice::par_iter`]($sus::collections::Slice::par_iter). It
+/// holds an iterator ref on the slice's owner for as long as the `ParIter`
+/// exists, while the producers it creates do not touch the (non-atomic) ref
+/// count from other threads.
+template <class T>
+class SliceSource final {
+ public:
+  using Item = const T&;
+
+  constexpr SliceSource(::sus::iter::IterRef ref, const T* ptr,
+                        usize len) noexcept
+      : ref_(::sus::move(ref)), ptr_(ptr), len_(len) {}
+
+  template <class Callback>
+  constexpr auto with_producer(const Callback& callback) && noexcept {
+    return ::sus::fn::call(callback, SliceProducer<T>(ptr_, len_));
+  }
+
+ private:
+  [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
+  const T* ptr_;
+  usize len_;
+};
+
+/// A producer which moves out of the elements of a `Vec`'s storage.
+template <class T>
+class VecProducer final {
+ public:
+  using Item = T;
+
+  constexpr VecProducer(T* ptr, usize len) noexcept : ptr_(ptr), len_(len) {}
+
+  constexpr usize len() const noexcept { return len_; }
+  constexpr ::sus::Tuple<VecProducer, VecProducer> split_at(
+      usize index) && noexcept {
+    return ::sus::Tuple<VecProducer, VecProducer>(
+        VecProducer(ptr_, index), VecProducer(ptr_ + index, len_ - index));
+  }
+  constexpr ::sus::iter::Iterator<Item> auto into_iter() && noexcept {
+    return ::sus::collections::SliceMut<T>::from_raw_parts_mut(
+               ::sus::marker::unsafe_fn, ptr_, len_)
+        .iter_mut()
+        .map([](T& t) -> T { return ::sus::move(t); });
+  }
+
+ private:
+  T* ptr_;
+  usize len_;
+};
+
+/// The source for [`Vec::into_par_iter`]($sus::collections::Vec::into_par_iter)
+/// which owns the `Vec`. The moved-from elements are destroyed along with the
+/// `Vec` once iteration is complete.
+template <class T>
+class VecSource final {
+ public:
+  using Item = T;
+
+  explicit constexpr VecSource(::sus::collections::Vec<T>&& vec) noexcept
+      : vec_(::sus::move(vec)) {}
+
+  template <class Callback>
+  constexpr auto with_producer(const Callback& callback) && noexcept {
+    auto vec = ::sus::move(vec_);
+    return ::sus::fn::call(callback,
+                           VecProducer<T>(vec.as_mut_ptr(), vec.len()));
+  }
+
+ private:
+  ::sus::collections::Vec<T> vec_;
+};
+
+/// A producer of the integers in a `Range`. It acts as its own source.
+template <class T>
+class RangeProducer final {
+  static_assert(::sus::num::IntegerNumeric<T>);
+
+ public:
+  using Item = T;
+
+  constexpr RangeProducer(T start, T finish) noexcept
+      : start_(start), finish_(finish) {}
+
+  template <class Callback>
+  constexpr auto with_producer(const Callback& callback) && noexcept {
+    return ::sus::fn::call(callback, ::sus::move(*this));
+  }
+
+  constexpr usize len() const noexcept {
+    if (start_ >= finish_) return 0u;
+    return ::sus::cast<usize>(finish_.abs_diff(start_));
+  }
+  constexpr ::sus::Tuple<RangeProducer, RangeProducer> split_at(
+      usize index) && noexcept {
+    // The `index` is at most `len()` so the result is in range, though the
+    // cast may wrap for signed types.
+    T mid = start_.wrapping_add(::sus::cast<T>(index));
+    return ::sus::Tuple<RangeProducer, RangeProducer>(
+        RangeProducer(start_, mid), RangeProducer(mid, finish_));
+  }
+  constexpr ::sus::iter::Iterator<Item> auto into_iter() && noexcept {
+    // Range iterates until `start == finish`, so an empty range is normalized.
+    return ::sus::ops::Range<T>(start_, start_ < finish_ ? finish_ : start_);
+  }
+
+ private:
+  T start_;
+  T finish_;
+};
+
+/// Applies a map function to each item of the `InnerProducer`.
+template <class InnerProducer, class MapFn>
+class MapProducer final {
+  using FromItem = typename InnerProducer::Item;
+
+ public:
+  using Item = std::invoke_result_t<const MapFn&, FromItem&&>;
+
+  constexpr MapProducer(InnerProducer&& inner, const MapFn& fn) noexcept
+      : inner_(::sus::move(inner)), fn_(&fn) {}
+
+  constexpr usize len() const noexcept { return inner_.len(); }
+  constexpr ::sus::Tuple<MapProducer, MapProducer> split_at(
+      usize index) && noexcept {
+    auto [left, right] = ::sus::move(inner_).split_at(index);
+    return ::sus::Tuple<MapProducer, MapProducer>(
+        MapProducer(::sus::move(left), *fn_),
+        MapProducer(::sus::move(right), *fn_));
+  }
+  constexpr ::sus::iter::Iterator<Item> auto into_iter() && noexcept {
+    return ::sus::move(inner_).into_iter().map(
+        [fn = fn_](FromItem&& item) -> Item {
+          return ::sus::fn::call(*fn, ::sus::forward<FromItem>(item));
+        });
+  }
+
+ private:
+  InnerProducer inner_;
+  const MapFn* fn_;
+};
+
+template <class InnerSource, class MapFn>
+class MapSource final {
+ public:
+  using Item = std::invoke_result_t<const MapFn&, typename InnerSource::Item&&>;
+
+  constexpr MapSource(InnerSource&& inner, MapFn&& fn) noexcept
+      : inner_(::sus::move(inner)), fn_(::sus::move(fn)) {}
+
+  template <class Callback>
+  constexpr auto with_producer(const Callback& callback) && noexcept {
+    return ::sus::move(inner_).with_producer(
+        [&callback, &fn = fn_]<class P>(P&& inner) {
+          return ::sus::fn::call(callback,
+                                 MapProducer<P, MapFn>(::sus::move(inner), fn));
+        });
+  }
+
+ private:
+  InnerSource inner_;
+  MapFn fn_;
+};
+
+/// Yields only the items of the `InnerProducer` that satisfy a predicate.
+template <class InnerProducer, class Pred>
+class FilterProducer final {
+ public:
+  using Item = typename InnerProducer::Item;
+
+  constexpr FilterProducer(InnerProducer&& inner, const Pred& pred) noexcept
+      : inner_(::sus::move(inner)), pred_(&pred) {}
+
+  constexpr usize len() const noexcept { return inner_.len(); }
+  constexpr ::sus::Tuple<FilterProducer, FilterProducer> split_at(
+      usize index) && noexcept {
+    auto [left, right] = ::sus::move(inner_).split_at(index);
+    return ::sus::Tuple<FilterProducer, FilterProducer>(
+        FilterProducer(::sus::move(left), *pred_),
+        FilterProducer(::sus::move(right), *pred_));
+  }
+  constexpr ::sus::iter::Iterator<Item> auto into_iter() && noexcept {
+    return ::sus::move(inner_).into_iter().filter(
+        [pred = pred_](const std::remove_reference_t<Item>& item) -> bool {
+          return ::sus::fn::call(*pred, item);
+        });
+  }
+
+ private:
+  InnerProducer inner_;
+  const Pred* pred_;
+};
+
+template <class InnerSource, class Pred>
+class FilterSource final {
+ public:
+  using Item = typename InnerSource::Item;
+
+  constexpr FilterSource(InnerSource&& inner, Pred&& pred) noexcept
+      : inner_(::sus::move(inner)), pred_(::sus::move(pred)) {}
+
+  template <class Callback>
+  constexpr auto with_producer(const Callback& callback) && noexcept {
+    return ::sus::move(inner_).with_producer(
+        [&callback, &pred = pred_]<class P>(P&& inner) {
+          return ::sus::fn::call(
+              callback, FilterProducer<P, Pred>(::sus::move(inner), pred));
+        });
+  }
+
+ private:
+  InnerSource inner_;
+  Pred pred_;
+};
+
+/// Folds each piece of the `InnerProducer` that is iterated into a single
+/// accumulator value, starting from the value returned by `IdentityFn`.
+template <class InnerProducer, class IdentityFn, class FoldFn>
+class FoldProducer final {
+  using FromItem = typename InnerProducer::Item;
+
+ public:
+  using Item = std::invoke_result_t<const IdentityFn&>;
+
+  constexpr FoldProducer(InnerProducer&& inner, const IdentityFn& identity,
+                         const FoldFn& fold) noexcept
+      : inner_(::sus::move(inner)), identity_(&identity), fold_(&fold) {}
+
+  constexpr usize len() const noexcept { return inner_.len(); }
+  constexpr ::sus::Tuple<FoldProducer, FoldProducer> split_at(
+      usize index) && noexcept {
+    auto [left, right] = ::sus::move(inner_).split_at(index);
+    return ::sus::Tuple<FoldProducer, FoldProducer>(
+        FoldProducer(::sus::move(left), *identity_, *fold_),
+        FoldProducer(::sus::move(right), *identity_, *fold_));
+  }
+  constexpr ::sus::iter::Iterator<Item> auto into_iter() && noexcept {
+    return ::sus::iter::once(::sus::move(inner_).into_iter().fold(
+        ::sus::fn::call(*identity_),
+        [fold = fold_](Item acc, FromItem&& item) -> Item {
+          return ::sus::fn::call(*fold, ::sus::move(acc),
+                                 ::sus::forward<FromItem>(item));
+        }));
+  }
+
+ private:
+  InnerProducer inner_;
+  const IdentityFn* identity_;
+  const FoldFn* fold_;
+};
+
+template <class InnerSource, class IdentityFn, class FoldFn>
+class FoldSource final {
+ public:
+  using Item = std::invoke_result_t<const IdentityFn&>;
+
+  constexpr FoldSource(InnerSource&& inner, IdentityFn&& identity,
+                       FoldFn&& fold) noexcept
+      : inner_(::sus::move(inner)),
+        identity_(::sus::move(identity)),
+        fold_(::sus::move(fold)) {}
+
+  template <class Callback>
+  constexpr auto with_producer(const Callback& callback) && noexcept {
+    return ::sus::move(inner_).with_producer(
+        [&callback, &identity = identity_, &fold = fold_]<class P>(P&& inner) {
+          return ::sus::fn::call(callback,
+                                 FoldProducer<P, IdentityFn, FoldFn>(
+                                     ::sus::move(inner), identity, fold));
+        });
+  }
+
+ private:
+  InnerSource inner_;
+  IdentityFn identity_;
+  FoldFn fold_;
+};
+
+}  // namespace sus::iter::par::__private
@@ -0,0 +1,266 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "sus/cmp/ord.h"
+#include "sus/collections/array.h"
+#include "sus/collections/vec.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/par/__private/producers.h"
+#include "sus/iter/sum.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/thread/thread_pool.h"
+
+namespace sus::iter {
+
+/// Data-parallel iteration.
+///
+/// A [`ParIter`]($sus::iter::par::ParIter) is created from a collection by
+/// [`Slice::par_iter`]($sus::collections::Slice::par_iter),
+/// [`Vec::into_par_iter`]($sus::collections::Vec::into_par_iter) or
+/// [`Range::par_iter`]($sus::ops::Range::par_iter). The collection is split
+/// into pieces which are iterated on the global work-stealing
+/// [`ThreadPool`]($sus::thread::ThreadPool::global), with one thread per
+/// hardware thread.
+///
+/// Closures given to a `ParIter` are called concurrently from multiple threads,
+/// so they must be [`Fn`]($sus::fn::Fn) and may only read from shared state or
+/// write to it through synchronization primitives.
+namespace par {}
+
+}  // namespace sus::iter
+
+namespace sus::iter::par {
+
+namespace __private {
+
+/// The result of a terminal operation which produces no value.
+struct Unit {};
+
+/// Splits `producer` in half recursively until pieces are no larger than
+/// `min_len`, then iterates each piece with `leaf` and combines the results of
+/// the two halves with `combine`. The halves are run through
+/// `ThreadPool::join()` so that idle threads can steal them.
+template <Producer P, class Leaf, class Combine>
+auto drive(P&& producer, usize min_len, const Leaf& leaf,
+           const Combine& combine) noexcept {
+  const usize len = producer.len();
+  if (len <= min_len) {
+    return ::sus::fn::call(leaf, ::sus::move(producer).into_iter());
+  }
+  auto halves = ::sus::move(producer).split_at(len / 2u);
+  auto [left, right] = ::sus::thread::ThreadPool::global().join(
+      [&]() {
+        return drive(::sus::move(halves.template at_mut<0u>()), min_len, leaf,
+                     combine);
+      },
+      [&]() {
+        return drive(::sus::move(halves.template at_mut<1u>()), min_len, leaf,
+                     combine);
+      });
+  return ::sus::fn::call(combine, ::sus::move(left), ::sus::move(right));
+}
+
+}  // namespace __private
+
+/// An iterator whose items are produced and consumed in parallel.
+///
+/// Unlike a sequential [`Iterator`]($sus::iter::Iterator), the `ParIter` does
+/// not hand out items one at a time. Instead it is consumed by a terminal
+/// operation such as [`for_each`]($sus::iter::par::ParIter::for_each),
+/// [`reduce`]($sus::iter::par::ParIter::reduce),
+/// [`sum`]($sus::iter::par::ParIter::sum) or
+/// [`collect_vec`]($sus::iter::par::ParIter::collect_vec), which blocks until
+/// all items have been processed across the thread pool.
+///
+/// The source is split into contiguous pieces of known length, and each piece
+/// is iterated sequentially with the normal [`Iterator`](
+/// $sus::iter::Iterator) adaptors, so the per-item cost is the same as
+/// sequential iteration.
+template <class Source>
+class [[nodiscard]] ParIter final {
+ public:
+  using Item = typename Source::Item;
+
+  /// #[doc.hidden]
+  explicit constexpr ParIter(Source&& source) noexcept
+      : source_(::sus::move(source)) {}
+
+  /// Type is Move.
+  ParIter(ParIter&&) = default;
+  ParIter& operator=(ParIter&&) = default;
+
+  /// Applies `fn` to each item, producing a new `ParIter` over the results.
+  ///
+  /// The function is called concurrently from multiple threads.
+  template <::sus::fn::Fn<::sus::fn::NonVoid(Item&&)> MapFn>
+  constexpr auto map(MapFn fn) && noexcept {
+    return ParIter<__private::MapSource<Source, MapFn>>(
+        __private::MapSource<Source, MapFn>(::sus::move(source_),
+                                            ::sus::move(fn)));
+  }
+
+  /// Produces a new `ParIter` which yields only the items for which `pred`
+  /// returns true.
+  ///
+  /// The predicate is called concurrently from multiple threads.
+  template <::sus::fn::Fn<bool(const std::remove_reference_t<Item>&)> Pred>
+  constexpr auto filter(Pred pred) && noexcept {
+    return ParIter<__private::FilterSource<Source, Pred>>(
+        __private::FilterSource<Source, Pred>(::sus::move(source_),
+                                              ::sus::move(pred)));
+  }
+
+  /// Folds the items of each piece of work into an accumulator, producing a
+  /// `ParIter` over the accumulators.
+  ///
+  /// Each piece starts from the value returned by `identity`, so the number of
+  /// accumulators depends on how the work was split. The accumulators are
+  /// usually combined afterward with
+  /// [`reduce`]($sus::iter::par::ParIter::reduce) or
+  /// [`sum`]($sus::iter::par::ParIter::sum). This allows accumulating into a
+  /// type that is expensive to combine, such as a `Vec`, without combining
+  /// after every item.
+  template <::sus::fn::Fn<::sus::fn::NonVoid()> IdentityFn, class FoldFn,
+            int&..., class B = std::invoke_result_t<const IdentityFn&>>
+    requires(::sus::fn::Fn<FoldFn, B(B, Item)>)
+  constexpr auto fold(IdentityFn identity, FoldFn fold) && noexcept {
+    return ParIter<__private::FoldSource<Source, IdentityFn, FoldFn>>(
+        __private::FoldSource<Source, IdentityFn, FoldFn>(
+            ::sus::move(source_), ::sus::move(identity), ::sus::move(fold)));
+  }
+
+  /// Calls `fn` on each item.
+  ///
+  /// The function is called concurrently from multiple threads, and items are
+  /// visited in no particular order.
+  template <::sus::fn::Fn<void(Item&&)> F>
+  void for_each(F fn) && noexcept {
+    static_cast<ParIter&&>(*this).drive(
+        [&fn](auto&& iter) {
+          ::sus::move(iter).for_each([&fn](Item&& item) {
+            ::sus::fn::call(fn, ::sus::forward<Item>(item));
+          });
+          return __private::Unit();
+        },
+        [](__private::Unit, __private::Unit) { return __private::Unit(); });
+  }
+
+  /// Reduces the items to a single value with the `op` function.
+  ///
+  /// The `identity` function returns the starting value for each piece of
+  /// work, and is returned if there are no items. The `op` must be associative
+  /// for the result to be deterministic, as the order in which items are
+  /// combined depends on how the work was split.
+  template <::sus::fn::Fn<Item()> IdentityFn,
+            ::sus::fn::Fn<Item(Item, Item)> Op>
+    requires(!std::is_reference_v<Item>)
+  Item reduce(IdentityFn identity, Op op) && noexcept {
+    return static_cast<ParIter&&>(*this).drive(
+        [&identity, &op](auto&& iter) -> Item {
+          return ::sus::move(iter).fold(
+              ::sus::fn::call(identity), [&op](Item acc, Item&& item) -> Item {
+                return ::sus::fn::call(op, ::sus::move(acc),
+                                       ::sus::move(item));
+              });
+        },
+        [&op](Item left, Item right) -> Item {
+          return ::sus::fn::call(op, ::sus::move(left), ::sus::move(right));
+        });
+  }
+
+  /// Sums the items in parallel.
+  ///
+  /// Each piece of work is summed with [`Iterator::sum`](
+  /// $sus::iter::IteratorBase::sum), and the partial sums are then summed
+  /// together. An empty `ParIter` returns the zero value of `P`.
+  template <class P = std::remove_cvref_t<Item>>
+    requires(::sus::iter::Sum<P, Item> && ::sus::iter::Sum<P, P>)
+  P sum() && noexcept {
+    return static_cast<ParIter&&>(*this).drive(
+        [](auto&& iter) -> P { return P::from_sum(::sus::move(iter)); },
+        [](P left, P right) -> P {
+          return P::from_sum(::sus::collections::Array<P, 2u>(
+                                 ::sus::move(left), ::sus::move(right))
+                                 .into_iter());
+        });
+  }
+
+  /// Counts the number of items.
+  usize count() && noexcept {
+    return static_cast<ParIter&&>(*this).drive(
+        [](auto&& iter) -> usize { return ::sus::move(iter).count(); },
+        [](usize left, usize right) -> usize { return left + right; });
+  }
+
+  /// Collects the items into a `Vec`, in the same order as they were in the
+  /// source.
+  ::sus::collections::Vec<Item> collect_vec() && noexcept
+    requires(!std::is_reference_v<Item>)
+  {
+    using V = ::sus::collections::Vec<Item>;
+    // Each piece of work is collected into its own `Vec`, and the pieces are
+    // only gathered in order while combining. Then the output is allocated
+    // once and each item is moved into it once.
+    auto pieces = static_cast<ParIter&&>(*this).drive(
+        [](auto&& iter) -> ::sus::collections::Vec<V> {
+          auto piece = ::sus::collections::Vec<V>::with_capacity(1u);
+          piece.push(::sus::move(iter).template collect<V>());
+          return piece;
+        },
+        [](::sus::collections::Vec<V> left,
+           ::sus::collections::Vec<V> right) -> ::sus::collections::Vec<V> {
+          left.extend(::sus::move(right));
+          return left;
+        });
+    if (pieces.len() == 1u) return ::sus::move(pieces[0u]);
+    usize total;
+    for (const V& piece : pieces) total += piece.len();
+    auto out = V::with_capacity(total);
+    for (V& piece : pieces.iter_mut()) out.extend(::sus::move(piece));
+    return out;
+  }
+
+ private:
+  template <class Leaf, class Combine>
+  auto drive(const Leaf& leaf, const Combine& combine) && noexcept {
+    return ::sus::move(source_).with_producer(
+        [&leaf, &combine]<class P>(P&& producer) {
+          const usize len = producer.len();
+          const usize threads =
+              ::sus::thread::ThreadPool::global().num_threads();
+          // Split into a few pieces per thread, so that threads which finish
+          // early can steal the remaining work. With a single thread, the work
+          // is not split at all.
+          const usize min_len =
+              threads > 1u ? ::sus::cmp::max(len / (threads * 4u), 1_usize)
+                           : len;
+          return __private::drive(::sus::move(producer), min_len, leaf,
+                                  combine);
+        });
+  }
+
+  Source source_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(source_));
+};
+
+}  // namespace sus::iter::par
@@ -0,0 +1,153 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/iter/par/par_iter.h"
+
+#include <atomic>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/boxed/box.h"
+#include "sus/collections/vec.h"
+#include "sus/ops/range.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::boxed::Box;
+
+sus::Vec<i32> make_vec(usize len) {
+  auto v = sus::Vec<i32>::with_capacity(len);
+  for (usize i : sus::ops::range(0_usize, len)) v.push(sus::cast<i32>(i));
+  return v;
+}
+
+TEST(ParIter, SliceForEach) {
+  auto v = make_vec(100'000u);
+  auto total = std::atomic<int64_t>(0);
+  v.par_iter().for_each([&total](const i32& i) {
+    total.fetch_add(i64::from(i).primitive_value, std::memory_order_relaxed);
+  });
+  EXPECT_EQ(total.load(), int64_t{100'000} * 99'999 / 2);
+}
+
+TEST(ParIter, SliceMapSum) {
+  auto v = make_vec(100'000u);
+  i64 sum = v.par_iter()
+                .map([](const i32& i) { return i64::from(i) * 2; })
+                .sum();
+  EXPECT_EQ(sum, 100'000_i64 * 99'999);
+}
+
+TEST(ParIter, SliceSum) {
+  // The items are references into the slice, and are summed into an `i32`.
+  auto v = make_vec(10'000u);
+  i32 sum = v.par_iter().sum();
+  EXPECT_EQ(sum, 10'000_i32 * 9'999 / 2);
+  EXPECT_EQ(v.par_iter().filter([](const i32& i) { return i < 1000; }).sum(),
+            1000_i32 * 999 / 2);
+}
+
+TEST(ParIter, SliceFilterCount) {
+  auto v = make_vec(100'000u);
+  EXPECT_EQ(
+      v.par_iter().filter([](const i32& i) { return i % 3 == 0; }).count(),
+      33'334u);
+}
+
+TEST(ParIter, Empty) {
+  auto v = sus::Vec<i32>();
+  EXPECT_EQ(v.par_iter().count(), 0u);
+  EXPECT_EQ(sus::move(v).into_par_iter().collect_vec().len(), 0u);
+  EXPECT_EQ(
+      sus::ops::range(5_i32, 5_i32).par_iter().reduce([]() { return 3_i32; },
+                                                       [](i32 a, i32 b) {
+                                                         return a + b;
+                                                       }),
+      3_i32);
+}
+
+TEST(ParIter, CollectVecKeepsOrder) {
+  auto v = make_vec(10'000u);
+  auto out = v.par_iter()
+                 .map([](const i32& i) { return i + 1; })
+                 .filter([](const i32& i) { return i % 2 == 0; })
+                 .collect_vec();
+  ASSERT_EQ(out.len(), 5'000u);
+  for (usize i : sus::ops::range(0_usize, out.len())) {
+    EXPECT_EQ(out[i], sus::cast<i32>(i) * 2 + 2);
+  }
+}
+
+TEST(ParIter, VecIntoParIter) {
+  auto v = sus::Vec<Box<i32>>::with_capacity(1'000u);
+  for (i32 i : sus::ops::range(0_i32, 1'000_i32)) v.push(Box<i32>(i));
+
+  auto out = sus::move(v)
+                 .into_par_iter()
+                 .map([](Box<i32>&& b) { return *b; })
+                 .collect_vec();
+  ASSERT_EQ(out.len(), 1'000u);
+  for (usize i : sus::ops::range(0_usize, out.len())) {
+    EXPECT_EQ(out[i], sus::cast<i32>(i));
+  }
+}
+
+TEST(ParIter, RangeReduce) {
+  auto hash = [](u64 i) { return (i * 7919u) % 1'000'003u; };
+  u64 expected;
+  for (u64 i : sus::ops::range(0_u64, 1'000'000_u64)) {
+    if (hash(i) > expected) expected = hash(i);
+  }
+  auto max = sus::ops::range(0_u64, 1'000'000_u64)
+                 .par_iter()
+                 .map(hash)
+                 .reduce([]() { return 0_u64; },
+                         [](u64 a, u64 b) { return a > b ? a : b; });
+  EXPECT_EQ(max, expected);
+
+  EXPECT_EQ(sus::ops::range(-1'000_i32, 1'000_i32).par_iter().count(), 2'000u);
+  EXPECT_EQ(sus::ops::range(i8::MIN, i8::MAX).par_iter().count(), 255u);
+  EXPECT_EQ(sus::ops::range(5_i32, 0_i32).par_iter().count(), 0u);
+}
+
+TEST(ParIter, FoldThenReduce) {
+  auto v = make_vec(10'000u);
+  auto even = v.par_iter()
+                  .fold([]() { return sus::Vec<i32>(); },
+                        [](sus::Vec<i32> acc, const i32& i) {
+                          if (i % 2 == 0) acc.push(i);
+                          return acc;
+                        })
+                  .reduce([]() { return sus::Vec<i32>(); },
+                          [](sus::Vec<i32> a, sus::Vec<i32> b) {
+                            a.extend(sus::move(b));
+                            return a;
+                          });
+  ASSERT_EQ(even.len(), 5'000u);
+  for (usize i : sus::ops::range(0_usize, even.len())) {
+    EXPECT_EQ(even[i], sus::cast<i32>(i) * 2);
+  }
+}
+
+TEST(ParIter, Nested) {
+  auto v = make_vec(100u);
+  auto total = std::atomic<size_t>(0);
+  v.par_iter().for_each([&total](const i32&) {
+    usize c = sus::ops::range(0_i32, 100_i32).par_iter().count();
+    total.fetch_add(c.primitive_value, std::memory_order_relaxed);
+  });
+  EXPECT_EQ(total.load(), 100u * 100u);
+}
+
+}  // namespace
@@ -0,0 +1,117 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::iter {
+
+using ::sus::option::Option;
+
+template <class ItemT>
+class RepeatN;
+
+/// Creates a new iterator that repeats a single element a given number of
+/// times.
+///
+/// The `repeat_n` function repeats a single value exactly `n` times. It is
+/// like [`repeat`]($sus::iter::repeat) followed by
+/// [`take(n)`]($sus::iter::IteratorBase::take), but the returned iterator
+/// knows its exact length, which allows it to be collected into a single
+/// allocation of the right size. And rather than cloning the element for the
+/// last item, the element itself is moved out.
+///
+/// # Example
+/// ```
+/// auto r = sus::iter::repeat_n<u16>(3_u16, 2u);
+/// sus_check(r.exact_size_hint() == 2u);
+/// sus_check(r.next().unwrap() == 3_u16);
+/// sus_check(r.next().unwrap() == 3_u16);
+/// sus_check(r.next().is_none());
+/// ```
+template <class Item>
+  requires ::sus::mem::Clone<Item>
+constexpr inline RepeatN<Item> repeat_n(Item item, usize n) noexcept {
+  return RepeatN<Item>(::sus::move(item), n);
+}
+
+/// An Iterator that repeats a single Item a fixed number of times.
+///
+/// This type is returned from [`repeat_n`]($sus::iter::repeat_n).
+template <class ItemT>
+class [[nodiscard]] RepeatN final
+    : public IteratorBase<RepeatN<ItemT>, ItemT> {
+ public:
+  using Item = ItemT;
+
+  // sus::mem::Clone trait.
+  constexpr RepeatN clone() const noexcept
+    requires(::sus::mem::Clone<Item>)
+  {
+    return RepeatN(CLONE, ::sus::clone(item_), count_);
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (count_ == 0u) return Option<Item>();
+    count_ -= 1u;
+    // The last item is the element itself, rather than a clone of it.
+    if (count_ == 0u) return item_.take();
+    return Option<Item>(::sus::clone(item_.as_value()));
+  }
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    return SizeHint(count_, ::sus::Option<::sus::num::usize>(count_));
+  }
+  // sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> next_back() noexcept { return next(); }
+
+  /// sus::iter::ExactSizeIterator trait.
+  constexpr usize exact_size_hint() const noexcept { return count_; }
+
+  /// sus::iter::TrustedLen trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept {
+    return {};
+  }
+
+ private:
+  friend RepeatN<Item> sus::iter::repeat_n<Item>(Item item, usize n) noexcept;
+
+  // The element is dropped right away when it is repeated 0 times.
+  constexpr RepeatN(Item item, usize count)
+      : item_(count > 0u ? Option<Item>(::sus::move(item)) : Option<Item>()),
+        count_(count) {}
+  // Ctor for Clone.
+  enum Clone { CLONE };
+  constexpr RepeatN(Clone, Option<Item> item, usize count)
+      : item_(::sus::move(item)), count_(count) {}
+
+  // Holds the element until the last item is returned.
+  Option<Item> item_;
+  usize count_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(item_), decltype(count_));
+};
+
+}  // namespace sus::iter
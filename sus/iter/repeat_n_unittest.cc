@@ -0,0 +1,84 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/iter/repeat_n.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+namespace {
+
+static_assert(sus::iter::TrustedLen<sus::iter::RepeatN<i32>>);
+static_assert(sus::iter::ExactSizeIterator<sus::iter::RepeatN<i32>, i32>);
+static_assert(sus::iter::DoubleEndedIterator<sus::iter::RepeatN<i32>, i32>);
+
+TEST(RepeatN, Example) {
+  auto r = sus::iter::repeat_n<u16>(3_u16, 2u);
+  sus_check(r.exact_size_hint() == 2u);
+  sus_check(r.next().unwrap() == 3_u16);
+  sus_check(r.next().unwrap() == 3_u16);
+  sus_check(r.next().is_none());
+}
+
+TEST(RepeatN, Next) {
+  auto o = sus::iter::repeat_n<u16>(3_u16, 3u);
+  EXPECT_EQ(o.size_hint(), sus::iter::SizeHint(3u, sus::some(3u)));
+  EXPECT_EQ(o.next(), sus::some(3_u16));
+  EXPECT_EQ(o.size_hint(), sus::iter::SizeHint(2u, sus::some(2u)));
+  EXPECT_EQ(o.next_back(), sus::some(3_u16));
+  EXPECT_EQ(o.size_hint(), sus::iter::SizeHint(1u, sus::some(1u)));
+  EXPECT_EQ(o.next(), sus::some(3_u16));
+  EXPECT_EQ(o.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+  EXPECT_EQ(o.next(), sus::none());
+  EXPECT_EQ(o.next_back(), sus::none());
+}
+
+TEST(RepeatN, Zero) {
+  auto o = sus::iter::repeat_n(sus::Vec<i32>(1, 2), 0u);
+  EXPECT_EQ(o.exact_size_hint(), 0u);
+  EXPECT_EQ(o.next(), sus::none());
+}
+
+TEST(RepeatN, MovesLast) {
+  auto v = sus::Vec<i32>(1, 2, 3);
+  const i32* data = v.as_ptr();
+  auto o = sus::iter::repeat_n(sus::move(v), 2u);
+  // The first is a clone, and the last is the original.
+  auto first = o.next().unwrap();
+  auto last = o.next().unwrap();
+  EXPECT_NE(first.as_ptr(), data);
+  EXPECT_EQ(last.as_ptr(), data);
+}
+
+TEST(RepeatN, Clone) {
+  auto o = sus::iter::repeat_n(sus::Vec<i32>(1, 2), 2u);
+  EXPECT_EQ(o.next().unwrap(), sus::Vec<i32>(1, 2));
+  auto c = sus::clone(o);
+  EXPECT_EQ(c.next().unwrap(), sus::Vec<i32>(1, 2));
+  EXPECT_EQ(c.next(), sus::none());
+  EXPECT_EQ(o.next().unwrap(), sus::Vec<i32>(1, 2));
+  EXPECT_EQ(o.next(), sus::none());
+}
+
+TEST(RepeatN, Collect) {
+  auto v = sus::iter::repeat_n(7_i32, 4u).collect_vec();
+  EXPECT_EQ(v, sus::Vec<i32>(7, 7, 7, 7));
+  EXPECT_EQ(v.capacity(), 4u);
+
+  static_assert(sus::iter::repeat_n(2_i32, 3u).sum() == 6);
+}
+
+}  // namespace
@@ -36,10 +36,15 @@ struct TryFromIteratorUnwrapper final
   using Item = ::sus::ops::TryOutputType<FromItem>;
 
   constexpr TryFromIteratorUnwrapper(SourceIter& iter,
+                                     ::sus::Option<Item>&& first,
                                      ::sus::Option<FromItem>& failure)
-      : iter(iter), failure(failure) {}
+      : iter(iter), first(::sus::move(first)), failure(failure) {}
 
   constexpr ::sus::Option<Item> next() noexcept {
+    if (first.is_some()) return first.take();
+    // Nothing more is pulled from `iter` after a failure, so that the failure
+    // is not replaced by a later one.
+    if (failure.is_some()) return ::sus::Option<Item>();
     ::sus::option::Option<FromItem> input = iter.next();
     if (input.is_some()) {
       if (::sus::ops::try_is_success(input.as_value())) {
@@ -51,11 +56,18 @@ struct TryFromIteratorUnwrapper final
     return ::sus::Option<Item>();
   }
 
+  // Any element pulled from `iter` may be a failure which ends the iteration,
+  // so only the buffered `first` element counts toward the lower bound.
   constexpr SizeHint size_hint() const noexcept {
-    return SizeHint(0u, iter.size_hint().upper);
+    if (failure.is_some()) return SizeHint(0u, ::sus::Option<usize>(0u));
+    const usize n = first.is_some() ? 1u : 0u;
+    return SizeHint(n, iter.size_hint().upper.and_then([n](usize u) {
+      return u.checked_add(n);
+    }));
   }
 
   SourceIter& iter;
+  ::sus::Option<Item> first;
   ::sus::Option<FromItem>& failure;
 };
 
@@ -90,11 +102,25 @@ constexpr inline ToType try_from_iter(IntoIter&& into_iter) noexcept
   auto&& iter = ::sus::move(into_iter).into_iter();
   using SourceIter = std::remove_reference_t<decltype(iter)>;
 
-  ::sus::Option<typename SourceIter::Item> failure;
-  auto out = ::sus::ops::try_from_output<ToType>(from_iter<C>(
-      __private::TryFromIteratorUnwrapper<SourceIter>(iter, failure)));
-  if (failure.is_some())
-    out = ::sus::ops::try_preserve_error<ToType>(::sus::move(failure).unwrap());
+  // When the first element is a failure, it's returned without building a
+  // collection at all.
+  ::sus::Option<FromType> first = iter.next();
+  if (first.is_some() && !::sus::ops::try_is_success(first.as_value())) {
+    return ::sus::ops::try_preserve_error<ToType>(
+        ::sus::move(first.as_value_mut()));
+  }
+
+  ::sus::Option<FromType> failure;
+  auto out = ::sus::ops::try_from_output<ToType>(
+      from_iter<C>(__private::TryFromIteratorUnwrapper<SourceIter>(
+          iter, ::sus::move(first).map(&::sus::ops::try_into_output<FromType>),
+          failure)));
+  // The error is moved directly from the failure into the output, without an
+  // intermediate.
+  if (failure.is_some()) {
+    out = ::sus::ops::try_preserve_error<ToType>(
+        ::sus::move(failure.as_value_mut()));
+  }
   return out;
 }
 
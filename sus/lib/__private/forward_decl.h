@@ -40,6 +40,11 @@ template <class T, size_t N>
 struct ArrayIntoIter;
 }
 
+namespace sus::collections {
+template <class T, size_t N>
+class ArrayWindows;
+}
+
 namespace sus::collections {
 template <class T>
 class Slice;
@@ -107,16 +112,28 @@ class IteratorBase;
 
 // Include iter/iterator.h to get the implementation of these.
 namespace sus::iter {
+template <class InnerSizedIter, size_t N>
+class ArrayChunks;
+template <class InnerSizedIter>
+class Batched;
 template <class RefIterator>
 class ByRef;
 template <class InnerSizedIter, class OtherSizedIter>
 class Chain;
+template <class InnerSizedIter, class KeyFn>
+class ChunkBy;
+template <class InnerSizedIter, class KeyFn>
+class ChunkByGroup;
 template <class InnerSizedIter>
 class Cloned;
 template <class InnerSizedIter>
 class Copied;
 template <class InnerSizedIter>
 class Cycle;
+template <class InnerSizedIter, class SameFn>
+class DedupBy;
+template <class InnerSizedIter, class KeyFn>
+class DedupByKey;
 template <class InnerSizedIter>
 class Enumerate;
 template <class InnerSizedIter, class Pred>
@@ -133,14 +150,26 @@ template <class Item>
 class Generator;
 template <class InnerSizedIter, class InspectFn>
 class Inspect;
+template <class InnerSizedIter, class CmpFn>
+class KMergeBy;
 template <class ToItem, class InnerSizedIter, class MapFn>
 class Map;
 template <class ToItem, class InnerSizedIter, class MapFn>
 class MapWhile;
+template <class InnerSizedIter, class OtherSizedIter, class CmpFn>
+class MergeBy;
+template <class InnerSizedIter, class OtherSizedIter, class CmpFn>
+class MergeJoinBy;
 template <class InnerSizedIter>
 class Moved;
 template <class InnerSizedIter>
 class Peekable;
+template <class InnerSizedIter, size_t N>
+class PeekableN;
+template <class InnerSizedIter, class AddrFn>
+class Prefetch;
+template <class InnerSizedIter>
+class PrefetchContiguous;
 template <class InnerSizedIter>
 class Reverse;
 template <class OutType, class State, class InnerSizedIter, class Fn>
@@ -149,6 +178,12 @@ template <class InnerIter>
 class Skip;
 template <class InnerIter, class Pred>
 class SkipWhile;
+template <class InnerSizedIter, class OtherSizedIter>
+class SortedDifference;
+template <class InnerSizedIter, class OtherSizedIter>
+class SortedIntersection;
+template <class InnerSizedIter, class OtherSizedIter>
+class SortedUnion;
 template <class InnerIter>
 class StepBy;
 template <class InnerIter>
@@ -165,6 +200,20 @@ namespace sus::iter {
 struct SizeHint;
 }
 
+// Include iter/par/par_iter.h to get the implementation of these.
+namespace sus::iter::par {
+template <class Source>
+class ParIter;
+}
+namespace sus::iter::par::__private {
+template <class T>
+class RangeProducer;
+template <class T>
+class SliceSource;
+template <class T>
+class VecSource;
+}  // namespace sus::iter::par::__private
+
 namespace sus::ptr {
 template <class T>
   requires(!std::is_reference_v<T>)
@@ -0,0 +1,315 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "sus/macros/pure.h"
+#include "sus/num/__private/check_integer_overflow.h"
+#include "sus/num/__private/intrinsics.h"
+
+// Reductions over contiguous arrays of numbers, which are used when summing (or
+// multiplying, etc) an iterator over a slice.
+//
+// The loops are written to be vectorized by the compiler: they keep
+// independent accumulators in `LANES` lanes, and integer overflow is tracked
+// with a flag that is checked once per `BLOCK` elements, rather than with a
+// branch on each element.
+//
+// The functions work on the numeric types in `sus::num` through their
+// `primitive_value` field, and on primitive numeric types directly.
+namespace sus::num::__private {
+
+inline constexpr size_t REDUCE_LANES = 8u;
+inline constexpr size_t REDUCE_BLOCK = 1024u;
+
+template <class S>
+__sus_pure_const _sus_always_inline constexpr auto reduce_value(
+    const S& s) noexcept {
+  if constexpr (std::is_arithmetic_v<S>)
+    return s;
+  else
+    return s.primitive_value;
+}
+
+__sus_pure_const _sus_always_inline constexpr size_t reduce_block_end(
+    size_t start, size_t len) noexcept {
+  return len - start < REDUCE_BLOCK ? len : start + REDUCE_BLOCK;
+}
+
+template <class S>
+using ReducePrimitive =
+    std::remove_cvref_t<decltype(reduce_value(std::declval<const S&>()))>;
+
+/// Sums `len` integers at `p`.
+///
+/// The result's `overflow` is set if an overflow would occur when adding the
+/// integers one at a time in order. If overflow checks are disabled, the sum
+/// wraps and `overflow` is never set.
+template <class S, class P = ReducePrimitive<S>>
+  requires(std::is_integral_v<P>)
+constexpr OverflowOut<P> contiguous_sum(const S* p, size_t len) noexcept {
+  using U = std::make_unsigned_t<P>;
+
+  if constexpr (!SUS_CHECK_INTEGER_OVERFLOW) {
+    // Wrapping addition is associative, so the compiler is free to reorder it
+    // into vector lanes. `MathType` avoids promotion to `int`.
+    MathType<U> sum = 0u;
+    for (size_t i = 0u; i < len; ++i)
+      sum += static_cast<MathType<U>>(static_cast<U>(reduce_value(p[i])));
+    return OverflowOut<P>{.overflow = false,
+                          .value = static_cast<P>(static_cast<U>(sum))};
+  } else if constexpr (sizeof(P) < 8u && !std::is_signed_v<P>) {
+    // Each block is summed in 64 bits, where it can not overflow. Unsigned
+    // addition only grows, so an intermediate sum overflows if and only if the
+    // total does.
+    uint64_t total = 0u;
+    for (size_t start = 0u; start < len; start += REDUCE_BLOCK) {
+      const size_t end = reduce_block_end(start, len);
+      uint64_t block = 0u;
+      for (size_t i = start; i < end; ++i)
+        block += static_cast<uint64_t>(reduce_value(p[i]));
+      total += block;
+      if (total > uint64_t{max_value<P>()}) [[unlikely]]
+        return OverflowOut<P>{.overflow = true,
+                              .value = static_cast<P>(total)};
+    }
+    return OverflowOut<P>{.overflow = false, .value = static_cast<P>(total)};
+  } else if constexpr (sizeof(P) < 8u) {
+    // Each block is summed in 64 bits, along with the sum of its positive and
+    // negative values. Every intermediate sum within the block lies between
+    // `total + neg` and `total + pos`, so if both fit then no intermediate sum
+    // overflows. Otherwise the block is added one element at a time to find
+    // whether an intermediate sum actually overflows.
+    int64_t total = 0;
+    for (size_t start = 0u; start < len; start += REDUCE_BLOCK) {
+      const size_t end = reduce_block_end(start, len);
+      int64_t pos = 0;
+      int64_t neg = 0;
+      for (size_t i = start; i < end; ++i) {
+        const auto v = static_cast<int64_t>(reduce_value(p[i]));
+        pos += v > 0 ? v : 0;
+        neg += v < 0 ? v : 0;
+      }
+      if (total + pos <= int64_t{max_value<P>()} &&
+          total + neg >= int64_t{min_value<P>()}) [[likely]] {
+        total += pos + neg;
+      } else {
+        auto acc = static_cast<P>(total);
+        for (size_t i = start; i < end; ++i) {
+          const auto out = add_with_overflow(acc, reduce_value(p[i]));
+          if (out.overflow) return out;
+          acc = out.value;
+        }
+        total = acc;
+      }
+    }
+    return OverflowOut<P>{.overflow = false, .value = static_cast<P>(total)};
+  } else if constexpr (!std::is_signed_v<P>) {
+    // 64-bit values can't be widened, so each lane keeps a carry flag instead.
+    P total = 0u;
+    for (size_t start = 0u; start < len; start += REDUCE_BLOCK) {
+      const size_t end = reduce_block_end(start, len);
+      P lanes[REDUCE_LANES] = {};
+      bool carry[REDUCE_LANES] = {};
+      size_t i = start;
+      for (; end - i >= REDUCE_LANES; i += REDUCE_LANES) {
+        for (size_t l = 0u; l < REDUCE_LANES; ++l) {
+          const P v = reduce_value(p[i + l]);
+          lanes[l] += v;
+          carry[l] |= lanes[l] < v;
+        }
+      }
+      bool overflow = false;
+      for (size_t l = 0u; l < REDUCE_LANES; ++l) {
+        const auto out = add_with_overflow(total, lanes[l]);
+        overflow |= carry[l] | out.overflow;
+        total = out.value;
+      }
+      for (; i < end; ++i) {
+        const auto out = add_with_overflow(total, reduce_value(p[i]));
+        overflow |= out.overflow;
+        total = out.value;
+      }
+      if (overflow) [[unlikely]]
+        return OverflowOut<P>{.overflow = true, .value = total};
+    }
+    return OverflowOut<P>{.overflow = false, .value = total};
+  } else {
+    // 64-bit values can't be widened, so the positive and negative values are
+    // summed separately in lanes, with a flag for each lane that overflows. As
+    // above, if `total + pos` and `total + neg` both fit then no intermediate
+    // sum overflows, otherwise the block is added one element at a time.
+    P total = 0;
+    for (size_t start = 0u; start < len; start += REDUCE_BLOCK) {
+      const size_t end = reduce_block_end(start, len);
+      U pos_lanes[REDUCE_LANES] = {};
+      U neg_lanes[REDUCE_LANES] = {};
+      bool carry[REDUCE_LANES] = {};
+      size_t i = start;
+      for (; end - i >= REDUCE_LANES; i += REDUCE_LANES) {
+        for (size_t l = 0u; l < REDUCE_LANES; ++l) {
+          const P v = reduce_value(p[i + l]);
+          // Magnitudes are summed as unsigned values, so that a wrap around is
+          // seen as the sum becoming smaller.
+          const U pos_v = v > 0 ? static_cast<U>(v) : U{0u};
+          const U neg_v = v < 0 ? U{0u} - static_cast<U>(v) : U{0u};
+          pos_lanes[l] += pos_v;
+          neg_lanes[l] += neg_v;
+          carry[l] |= (pos_lanes[l] < pos_v) | (neg_lanes[l] < neg_v);
+        }
+      }
+      bool fits = true;
+      U pos = 0u;
+      U neg = 0u;
+      for (size_t l = 0u; l < REDUCE_LANES; ++l) {
+        fits &= !carry[l];
+        const auto pos_out = add_with_overflow(pos, pos_lanes[l]);
+        const auto neg_out = add_with_overflow(neg, neg_lanes[l]);
+        fits &= !pos_out.overflow & !neg_out.overflow;
+        pos = pos_out.value;
+        neg = neg_out.value;
+      }
+      // `total + pos <= MAX` and `total - neg >= MIN`. The distances from
+      // `total` to `MAX` and `MIN` always fit in the unsigned type.
+      fits &= pos <= static_cast<U>(static_cast<U>(max_value<P>()) -
+                                    static_cast<U>(total));
+      fits &= neg <= static_cast<U>(static_cast<U>(total) -
+                                    static_cast<U>(min_value<P>()));
+      if (fits) [[likely]] {
+        total = static_cast<P>(static_cast<U>(total) + pos - neg);
+      } else {
+        i = start;
+      }
+      for (; i < end; ++i) {
+        const auto out = add_with_overflow(total, reduce_value(p[i]));
+        if (out.overflow) return out;
+        total = out.value;
+      }
+    }
+    return OverflowOut<P>{.overflow = false, .value = total};
+  }
+}
+
+/// Multiplies `len` integers at `p`.
+///
+/// The result's `overflow` is set if an overflow would occur when multiplying
+/// the integers one at a time in order. If overflow checks are disabled, the
+/// product wraps and `overflow` is never set.
+template <class S, class P = ReducePrimitive<S>>
+  requires(std::is_integral_v<P>)
+constexpr OverflowOut<P> contiguous_product(const S* p, size_t len) noexcept {
+  using U = std::make_unsigned_t<P>;
+
+  if constexpr (!SUS_CHECK_INTEGER_OVERFLOW) {
+    // Wrapping multiplication is associative, so the compiler is free to
+    // reorder it into vector lanes. `MathType` avoids promotion to `int`.
+    MathType<U> product = 1u;
+    for (size_t i = 0u; i < len; ++i)
+      product *= static_cast<MathType<U>>(static_cast<U>(reduce_value(p[i])));
+    return OverflowOut<P>{.overflow = false,
+                          .value = static_cast<P>(static_cast<U>(product))};
+  } else {
+    // The product depends on every earlier element, so it can't be split into
+    // lanes without changing where an overflow occurs. The overflow flag is
+    // still accumulated and checked once per block.
+    P product = 1;
+    for (size_t start = 0u; start < len; start += REDUCE_BLOCK) {
+      const size_t end = reduce_block_end(start, len);
+      bool overflow = false;
+      for (size_t i = start; i < end; ++i) {
+        const auto out = mul_with_overflow(product, reduce_value(p[i]));
+        overflow |= out.overflow;
+        product = out.value;
+      }
+      if (overflow) [[unlikely]]
+        return OverflowOut<P>{.overflow = true, .value = product};
+    }
+    return OverflowOut<P>{.overflow = false, .value = product};
+  }
+}
+
+/// Sums `len` floating point values at `p`, in `REDUCE_LANES` interleaved
+/// lanes which are then added together.
+///
+/// Floating point addition is not associative, so the result may be rounded
+/// differently than when adding the values one at a time in order.
+template <class S, class P = ReducePrimitive<S>>
+  requires(std::is_floating_point_v<P>)
+constexpr P contiguous_sum(const S* p, size_t len) noexcept {
+  P lanes[REDUCE_LANES] = {};
+  size_t i = 0u;
+  for (; len - i >= REDUCE_LANES; i += REDUCE_LANES) {
+    for (size_t l = 0u; l < REDUCE_LANES; ++l)
+      lanes[l] += reduce_value(p[i + l]);
+  }
+  P sum = P{0};
+  for (size_t l = 0u; l < REDUCE_LANES; ++l) sum += lanes[l];
+  for (; i < len; ++i) sum += reduce_value(p[i]);
+  return sum;
+}
+
+/// Multiplies `len` floating point values at `p`, in `REDUCE_LANES`
+/// interleaved lanes which are then multiplied together.
+///
+/// Floating point multiplication is not associative, so the result may be
+/// rounded differently than when multiplying the values one at a time in
+/// order.
+template <class S, class P = ReducePrimitive<S>>
+  requires(std::is_floating_point_v<P>)
+constexpr P contiguous_product(const S* p, size_t len) noexcept {
+  P lanes[REDUCE_LANES];
+  for (P& l : lanes) l = P{1};
+  size_t i = 0u;
+  for (; len - i >= REDUCE_LANES; i += REDUCE_LANES) {
+    for (size_t l = 0u; l < REDUCE_LANES; ++l)
+      lanes[l] *= reduce_value(p[i + l]);
+  }
+  P product = P{1};
+  for (size_t l = 0u; l < REDUCE_LANES; ++l) product *= lanes[l];
+  for (; i < len; ++i) product *= reduce_value(p[i]);
+  return product;
+}
+
+/// Returns the smallest of `len` integers at `p`, where `len` is not zero.
+template <class S, class P = ReducePrimitive<S>>
+  requires(std::is_integral_v<P>)
+constexpr P contiguous_min(const S* p, size_t len) noexcept {
+  P m = reduce_value(p[0u]);
+  for (size_t i = 1u; i < len; ++i) {
+    const P v = reduce_value(p[i]);
+    m = v < m ? v : m;
+  }
+  return m;
+}
+
+/// Returns the largest of `len` integers at `p`, where `len` is not zero.
+template <class S, class P = ReducePrimitive<S>>
+  requires(std::is_integral_v<P>)
+constexpr P contiguous_max(const S* p, size_t len) noexcept {
+  P m = reduce_value(p[0u]);
+  for (size_t i = 1u; i < len; ++i) {
+    const P v = reduce_value(p[i]);
+    m = v > m ? v : m;
+  }
+  return m;
+}
+
+}  // namespace sus::num::__private
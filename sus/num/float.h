@@ -28,6 +28,7 @@
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
+#include "sus/num/__private/contiguous_reduce.h"
 #include "sus/num/__private/float_ordering.h"
 #include "sus/num/__private/intrinsics.h"
 #include "sus/num/__private/literals.h"
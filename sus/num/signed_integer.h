@@ -31,6 +31,7 @@
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
 #include "sus/num/__private/check_integer_overflow.h"
+#include "sus/num/__private/contiguous_reduce.h"
 #include "sus/num/__private/int_log10.h"
 #include "sus/num/__private/intrinsics.h"
 #include "sus/num/__private/literals.h"
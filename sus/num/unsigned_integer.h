@@ -29,10 +29,12 @@
 #include "sus/lib/__private/forward_decl.h"
 #include "sus/macros/__private/compiler_bugs.h"
 #include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
 #include "sus/num/__private/check_integer_overflow.h"
+#include "sus/num/__private/contiguous_reduce.h"
 #include "sus/num/__private/int_log10.h"
 #include "sus/num/__private/intrinsics.h"
 #include "sus/num/__private/literals.h"
@@ -15,10 +15,18 @@
 #pragma once
 
 #include "sus/cmp/ord.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/iterator_end.h"
 #include "sus/iter/__private/step.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/addressof.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/ops/try.h"
 #include "sus/option/option.h"
 #include "sus/string/__private/any_formatter.h"
 #include "sus/string/__private/format_to_stream.h"
@@ -58,19 +66,54 @@ namespace __private {
 template <class Final, class T, bool = ::sus::iter::__private::Step<T>>
 class RangeIter;
 
+/// A ranged-for loop over a `Range`, which steps the range directly instead of
+/// producing an `Option` for each value through `next()`.
+template <class T>
+class [[nodiscard]] RangeLoop final {
+ public:
+  constexpr RangeLoop(T& start, const T& finish) noexcept
+      : start_(start), finish_(finish) {}
+
+  constexpr inline bool operator==(
+      ::sus::iter::__private::IteratorEnd) const noexcept {
+    return !(start_ < finish_);
+  }
+  // The range is advanced in `operator*()` so that, like with `next()`, the
+  // value is consumed from the range when it is returned.
+  constexpr inline void operator++() & noexcept {}
+  constexpr inline T operator*() & noexcept {
+    // SAFETY: `start_ < finish_` so `start_ + 1` can not overflow.
+    return ::sus::mem::replace(
+        start_, ::sus::iter::__private::step_forward_by_unchecked(
+                    ::sus::marker::unsafe_fn, start_, 1u));
+  }
+
+ private:
+  T& start_;
+  const T& finish_;
+};
+
 template <class Final, class T>
 class RangeIter<Final, T, true> : public ::sus::iter::IteratorBase<Final, T> {
  public:
   using Item = T;
 
+  /// Adaptor for use in ranged for loops.
+  ///
+  /// The loop increments the range's start without an overflow check or an
+  /// `Option` per value, so it compiles like a loop over a primitive integer.
+  constexpr RangeLoop<T> begin() & noexcept {
+    return RangeLoop<T>(final_mut().start, final_mut().finish);
+  }
+
   // sus::iter::Iterator trait.
   constexpr Option<T> next() noexcept {
-    if (static_cast<Final*>(this)->start == static_cast<Final*>(this)->finish)
-      return Option<T>();
-    return Option<T>(
-        ::sus::mem::replace(static_cast<Final*>(this)->start,
-                            ::sus::iter::__private::step_forward(
-                                static_cast<Final*>(this)->start)));
+    Final& self = final_mut();
+    if (!(self.start < self.finish)) return Option<T>();
+    // SAFETY: `start < finish` so `start + 1` can not overflow.
+    return Option<T>(::sus::mem::replace(
+        self.start, ::sus::iter::__private::step_forward_by_unchecked(
+                        ::sus::marker::unsafe_fn, self.start, 1u)));
   }
 
   // sus::iter::Iterator trait.
@@ -89,15 +132,129 @@ class RangeIter<Final, T, true> : public ::sus::iter::IteratorBase<Final, T> {
 
   // sus::iter::DoubleEndedIterator trait.
   constexpr Option<T> next_back() noexcept {
-    if (static_cast<Final*>(this)->start == static_cast<Final*>(this)->finish)
+    Final& self = final_mut();
+    if (!(self.start < self.finish)) return Option<T>();
+    // SAFETY: `start < finish` so `finish - 1` can not overflow.
+    self.finish = ::sus::iter::__private::step_backward_by_unchecked(
+        ::sus::marker::unsafe_fn, self.finish, 1u);
+    return Option<T>(self.finish);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Steps over `n` values at once.
+  constexpr Option<T> nth(usize n) noexcept {
+    Final& self = final_mut();
+    if (!(self.start < self.finish)) return Option<T>();
+    // If the number of steps does not fit in usize, then `n` is in range.
+    Option<usize> steps =
+        ::sus::iter::__private::steps_between(self.start, self.finish);
+    if (steps.is_some() && n >= steps.as_value()) {
+      self.start = self.finish;
       return Option<T>();
-    static_cast<Final*>(this)->finish = ::sus::iter::__private::step_backward(
-        static_cast<Final*>(this)->finish);
-    return Option<T>(static_cast<Final*>(this)->finish);
+    }
+    // SAFETY: `start + n < finish` so it can not overflow.
+    self.start = ::sus::iter::__private::step_forward_by_unchecked(
+        ::sus::marker::unsafe_fn, self.start, n);
+    return next();
   }
 
-  // TODO: Provide and test overrides of Iterator min(), max(), count(),
-  // advance_by(), etc that can be done efficiently here.
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Steps over `n` values at once.
+  constexpr Option<T> nth_back(usize n) noexcept {
+    Final& self = final_mut();
+    if (!(self.start < self.finish)) return Option<T>();
+    Option<usize> steps =
+        ::sus::iter::__private::steps_between(self.start, self.finish);
+    if (steps.is_some() && n >= steps.as_value()) {
+      self.finish = self.start;
+      return Option<T>();
+    }
+    // SAFETY: `finish - n > start` so it can not overflow.
+    self.finish = ::sus::iter::__private::step_backward_by_unchecked(
+        ::sus::marker::unsafe_fn, self.finish, n);
+    return next_back();
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Folds the values in a single loop, rather than through `next()`.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, T)> F>
+  constexpr B fold(B init, F f) && noexcept {
+    Final& self = final_mut();
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      for (; self.start < self.finish; self.start = step(self.start)) {
+        out = ::sus::mem::addressof(
+            ::sus::fn::call_mut(f, *out, T(self.start)));
+      }
+      return *out;
+    } else {
+      for (; self.start < self.finish; self.start = step(self.start))
+        init = ::sus::fn::call_mut(f, ::sus::move(init), T(self.start));
+      return init;
+    }
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, T)> F>
+  constexpr B rfold(B init, F f) && noexcept {
+    Final& self = final_mut();
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      while (self.start < self.finish) {
+        self.finish = step_back(self.finish);
+        out = ::sus::mem::addressof(
+            ::sus::fn::call_mut(f, *out, T(self.finish)));
+      }
+      return *out;
+    } else {
+      while (self.start < self.finish) {
+        self.finish = step_back(self.finish);
+        init = ::sus::fn::call_mut(f, ::sus::move(init), T(self.finish));
+      }
+      return init;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, T)> F, int&...,
+            class R = std::invoke_result_t<F&, B&&, T&&>>
+    requires(::sus::ops::Try<R> &&
+             std::convertible_to<typename ::sus::ops::TryImpl<R>::Output, B>)
+  constexpr R try_fold(B init, F f) noexcept {
+    Final& self = final_mut();
+    while (self.start < self.finish) {
+      R out = ::sus::fn::call_mut(
+          f, ::sus::move(init),
+          ::sus::mem::replace(self.start, step(self.start)));
+      if (!::sus::ops::try_is_success(out)) return out;
+      init = ::sus::ops::try_into_output(::sus::move(out));
+    }
+    return ::sus::ops::try_from_output<R>(::sus::move(init));
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// The number of values in the range is known, so they are not iterated.
+  constexpr usize count() && noexcept { return exact_size_hint(); }
+
+ private:
+  constexpr Final& final_mut() noexcept { return *static_cast<Final*>(this); }
+
+  // Steps forward from a value that is less than the end of the range.
+  static constexpr T step(const T& t) noexcept {
+    // SAFETY: `t` is less than another `T` so `t + 1` can not overflow.
+    return ::sus::iter::__private::step_forward_by_unchecked(
+        ::sus::marker::unsafe_fn, t, 1u);
+  }
+  // Steps backward from a value that is greater than the start of the range.
+  static constexpr T step_back(const T& t) noexcept {
+    // SAFETY: `t` is greater than another `T` so `t - 1` can not overflow.
+    return ::sus::iter::__private::step_backward_by_unchecked(
+        ::sus::marker::unsafe_fn, t, 1u);
+  }
 };
 
 template <class Final, class T>
@@ -216,6 +373,21 @@ class Range final : public __private::RangeIter<Range<T>, T> {
     return Range(::sus::move(start), ::sus::move(t));
   }
 
+  /// Returns a parallel iterator over the integers in the range.
+  ///
+  /// The range is split into pieces which are iterated concurrently on a
+  /// work-stealing thread pool. Include "sus/iter/par/par_iter.h" to use the
+  /// returned [`ParIter`]($sus::iter::par::ParIter).
+  constexpr ::sus::iter::par::ParIter<
+      ::sus::iter::par::__private::RangeProducer<T>>
+  par_iter() const& noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return ::sus::iter::par::ParIter<
+        ::sus::iter::par::__private::RangeProducer<T>>(
+        ::sus::iter::par::__private::RangeProducer<T>(start, finish));
+  }
+
   /// Compares two `Range` for equality, satisfying the [`Eq`]($sus::cmp::Eq)
   /// concept if `T` satisfies [`Eq`]($sus::cmp::Eq).
   constexpr bool operator==(const Range& rhs) const noexcept
@@ -18,6 +18,7 @@
 
 #include "googletest/include/gtest/gtest.h"
 #include "sus/construct/default.h"
+#include "sus/iter/iterator.h"
 #include "sus/macros/compiler.h"
 #include "sus/prelude.h"
 
@@ -315,6 +316,120 @@ TEST(Range, RangeForIterator) {
   EXPECT_EQ(v.len(), 3u);
 }
 
+TEST(Range, RangeForBreak) {
+  // Leaving the loop early leaves the rest of the range to be iterated.
+  auto r = "1..6"_r;
+  for (usize i : r) {
+    if (i == 2u) break;
+  }
+  EXPECT_EQ(r.start, 3u);
+  EXPECT_EQ(r.next().unwrap(), 3u);
+
+  // The range is consumed by the loop.
+  for (usize i : r) {
+    EXPECT_GT(i, 3u);
+  }
+  EXPECT_EQ(r.next(), sus::None);
+
+  // Empty and reversed ranges produce nothing.
+  for (i32 i : sus::ops::range(3_i32, 3_i32)) ADD_FAILURE() << i;
+  for (i32 i : sus::ops::range(3_i32, 1_i32)) ADD_FAILURE() << i;
+}
+
+TEST(Range, Nth) {
+  auto r = "1..10"_r;
+  EXPECT_EQ(r.nth(0u).unwrap(), 1u);
+  EXPECT_EQ(r.nth(2u).unwrap(), 4u);
+  EXPECT_EQ(r.nth_back(0u).unwrap(), 9u);
+  EXPECT_EQ(r.nth_back(2u).unwrap(), 6u);
+  EXPECT_EQ(r.exact_size_hint(), 1u);
+  EXPECT_EQ(r.nth(1u), sus::None);
+  EXPECT_EQ(r.next(), sus::None);
+
+  auto back = "1..10"_r;
+  EXPECT_EQ(back.nth_back(9u), sus::None);
+  EXPECT_EQ(back.next(), sus::None);
+
+  // Signed ranges can cover more than half of the unsigned range.
+  auto s = sus::ops::range(i8::MIN, i8::MAX);
+  EXPECT_EQ(s.exact_size_hint(), 255u);
+  EXPECT_EQ(s.nth(253u).unwrap(), 125_i8);
+  EXPECT_EQ(s.next().unwrap(), 126_i8);
+  EXPECT_EQ(s.next(), sus::None);
+  auto sb = sus::ops::range(i8::MIN, i8::MAX);
+  EXPECT_EQ(sb.nth_back(254u).unwrap(), i8::MIN);
+  EXPECT_EQ(sb.next(), sus::None);
+
+  auto e = sus::ops::range(5_i32, 2_i32);
+  EXPECT_EQ(e.nth(0u), sus::None);
+  EXPECT_EQ(e.nth_back(0u), sus::None);
+}
+
+TEST(Range, Fold) {
+  EXPECT_EQ(sus::ops::range(0_usize, 101_usize).sum(), 5050u);
+  EXPECT_EQ(sus::ops::range(0_usize, 0_usize).sum(), 0u);
+  EXPECT_EQ(sus::ops::range(5_i32, 2_i32).sum(), 0);
+  EXPECT_EQ(sus::ops::range(i8::MIN, i8::MAX).count(), 255u);
+  EXPECT_EQ(sus::ops::range(3_i32, 1_i32).count(), 0u);
+
+  // Folding from either end visits the values in order.
+  auto forward = sus::ops::range(1_i32, 5_i32).fold(
+      0_i32, [](i32 acc, i32 i) { return acc * 10 + i; });
+  EXPECT_EQ(forward, 1234);
+  auto backward = sus::ops::range(1_i32, 5_i32).rev().fold(
+      0_i32, [](i32 acc, i32 i) { return acc * 10 + i; });
+  EXPECT_EQ(backward, 4321);
+  auto rbackward = sus::ops::range(1_i32, 5_i32).rev().rfold(
+      0_i32, [](i32 acc, i32 i) { return acc * 10 + i; });
+  EXPECT_EQ(rbackward, 1234);
+
+  // Folding to a reference.
+  i32 total;
+  i32& out = sus::ops::range(1_i32, 5_i32).fold<i32&>(
+      total, [](i32& acc, i32 i) -> i32& {
+        acc += i;
+        return acc;
+      });
+  EXPECT_EQ(&out, &total);
+  EXPECT_EQ(total, 1 + 2 + 3 + 4);
+
+  // try_fold stops early, leaving the rest of the range.
+  auto r = sus::ops::range(1_i32, 10_i32);
+  auto found = r.try_fold(0_i32, [](i32 acc, i32 i) -> sus::Option<i32> {
+    if (i == 4) return sus::none();
+    return sus::some(acc + i);
+  });
+  EXPECT_EQ(found, sus::None);
+  EXPECT_EQ(r.next().unwrap(), 5);
+  auto done = r.try_fold(0_i32, [](i32 acc, i32 i) -> sus::Option<i32> {
+    return sus::some(acc + i);
+  });
+  EXPECT_EQ(done.unwrap(), 6 + 7 + 8 + 9);
+
+  // The reversed range finds from the back.
+  auto rev = sus::ops::range(1_i32, 10_i32).rev();
+  EXPECT_EQ(rev.find([](const i32& i) { return i % 4 == 0; }).unwrap(), 8);
+  EXPECT_EQ(rev.nth(1u).unwrap(), 6);
+  EXPECT_EQ(rev.nth_back(0u).unwrap(), 1);
+  EXPECT_EQ(sus::move(rev).collect_vec(), sus::Vec<i32>(5, 4, 3, 2));
+}
+
+TEST(Range, StepBy) {
+  auto v = sus::ops::range(0_i32, 10_i32).step_by(3u).collect_vec();
+  EXPECT_EQ(v, sus::Vec<i32>(0, 3, 6, 9));
+  auto rv = sus::ops::range(0_i32, 10_i32).step_by(3u).rev().collect_vec();
+  EXPECT_EQ(rv, sus::Vec<i32>(9, 6, 3, 0));
+  auto rv2 = sus::ops::range(0_i32, 11_i32).step_by(4u).rev().collect_vec();
+  EXPECT_EQ(rv2, sus::Vec<i32>(8, 4, 0));
+  auto s = sus::ops::range(0_usize, 1000_usize).step_by(7u).sum();
+  usize expect;
+  for (size_t i = 0; i < 1000; i += 7) expect += i;
+  EXPECT_EQ(s, expect);
+  EXPECT_EQ(sus::ops::range(0_i32, 0_i32).step_by(2u).next(), sus::None);
+  EXPECT_EQ(sus::ops::range(i8::MIN, i8::MAX).step_by(100u).collect_vec(),
+            sus::Vec<i8>(i8::MIN, -28_i8, 72_i8));
+}
+
 TEST(Range, StructuredBindings) {
   auto [a, b] = "1..5"_r;
   EXPECT_EQ(a, 1u);
@@ -335,6 +450,10 @@ TEST(Range, Primitives) {
     sum += i;
   }
   EXPECT_EQ(sum, 2 + 3 + 4);
+
+  EXPECT_EQ(sus::ops::range(int8_t{-128}, int8_t{127}).count(), 255u);
+  EXPECT_EQ(sus::ops::range(int8_t{-128}, int8_t{127}).nth(254u).unwrap(),
+            int8_t{126});
 }
 
 TEST(Range, fmt) {
@@ -1060,6 +1060,7 @@ struct sus::iter::FromIteratorImpl<::sus::result::Result<T, E>> {
 
       // sus::iter::Iterator trait.
       constexpr Option<U> next() noexcept {
+        if (err.is_some()) return Option<U>();
         Option<::sus::result::Result<U, E>> try_item = iter.next();
         if (try_item.is_none()) return Option<U>();
         ::sus::result::Result<U, E> result =
@@ -1072,6 +1073,7 @@ struct sus::iter::FromIteratorImpl<::sus::result::Result<T, E>> {
         return Option<U>();
       }
       constexpr ::sus::iter::SizeHint size_hint() const noexcept {
+        if (err.is_some()) return ::sus::iter::SizeHint(0u, Option<usize>(0u));
         return ::sus::iter::SizeHint(0u, iter.size_hint().upper);
       }
 
@@ -1083,8 +1085,10 @@ struct sus::iter::FromIteratorImpl<::sus::result::Result<T, E>> {
     auto iter = Unwrapper(::sus::move(result_iter).into_iter(), err);
     auto out = ::sus::result::Result<T, E>(
         ::sus::iter::from_iter<T>(::sus::move(iter)));
-    if (err.is_some())
-      out = ::sus::result::Result<T, E>::with_err(::sus::move(err).unwrap());
+    if (err.is_some()) {
+      out = ::sus::result::Result<T, E>::with_err(
+          ::sus::move(err).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
     return out;
   }
 };
@@ -0,0 +1,112 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/thread/thread_pool.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/mem/move.h"
+#include "sus/option/option.h"
+
+namespace sus::thread::__private {
+
+/// A unit of work which can be queued in a `ThreadPool`. Jobs are referred to
+/// by pointer, and the owner of a job must keep it alive until it has been
+/// executed.
+struct Job {
+  void (*execute_fn)(Job* job) noexcept;
+
+  void execute() noexcept { execute_fn(this); }
+};
+
+/// A job for the `F` closure which lives on the stack of the thread calling
+/// `ThreadPool::join()`, and which may be stolen and executed by another
+/// thread. The `done` flag is set once the result has been stored.
+template <class F>
+struct StackJob final : public Job {
+  using R = ::sus::fn::ReturnOnce<F>;
+
+  explicit StackJob(F& f) noexcept : Job(&StackJob::run), f(f) {}
+
+  static void run(Job* job) noexcept {
+    auto& self = *static_cast<StackJob*>(job);
+    self.result.insert(::sus::fn::call_once(::sus::move(self.f)));
+    self.done.store(true, std::memory_order_release);
+  }
+
+  F& f;
+  Option<R> result;
+  std::atomic<bool> done = false;
+};
+
+/// Stands in for the result of a task which returns `void`.
+struct NoResult {};
+
+/// The state shared between a task given to `ThreadPool::spawn()` and the
+/// `JoinHandle` returned for it. It is destroyed once both are done with it.
+template <class R>
+struct TaskState {
+  explicit TaskState(void (*destroy_fn)(TaskState* state) noexcept) noexcept
+      : destroy_fn(destroy_fn) {}
+
+  /// Drops one reference to the state, destroying it if it was the last.
+  void release() noexcept {
+    if (refs.fetch_sub(1u, std::memory_order_acq_rel) == 1u) destroy_fn(this);
+  }
+
+  void (*destroy_fn)(TaskState* state) noexcept;
+  // One reference is held by the task until it has run, and one by its
+  // `JoinHandle`.
+  std::atomic<uint32_t> refs = 2u;
+  // Set once the task has run and its result has been stored.
+  std::atomic<bool> done = false;
+  std::conditional_t<std::is_void_v<R>, NoResult, Option<R>> result;
+};
+
+/// A job for a task given to `ThreadPool::spawn()`, which owns the task and
+/// stores its result for the task's `JoinHandle`.
+template <class F>
+struct HeapJob final : public Job, public TaskState<::sus::fn::ReturnOnce<F>> {
+  using R = ::sus::fn::ReturnOnce<F>;
+
+  explicit HeapJob(F&& f) noexcept
+      : Job(&HeapJob::run),
+        TaskState<R>(&HeapJob::destroy),
+        f(::sus::move(f)) {}
+
+  static void run(Job* job) noexcept {
+    auto* self = static_cast<HeapJob*>(job);
+    if constexpr (std::is_void_v<R>)
+      ::sus::fn::call_once(::sus::move(self->f));
+    else
+      self->result.insert(::sus::fn::call_once(::sus::move(self->f)));
+    self->done.store(true, std::memory_order_release);
+    self->done.notify_all();
+    self->release();
+  }
+
+  static void destroy(TaskState<R>* state) noexcept {
+    delete static_cast<HeapJob*>(state);
+  }
+
+  F f;
+};
+
+}  // namespace sus::thread::__private
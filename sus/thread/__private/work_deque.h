@@ -0,0 +1,148 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/thread/thread_pool.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "sus/thread/__private/job.h"
+
+namespace sus::thread::__private {
+
+/// A Chase-Lev work-stealing deque of `Job` pointers.
+///
+/// The owning worker thread pushes and pops jobs at the bottom without taking
+/// any locks, while other threads steal jobs from the top. The implementation
+/// follows "Correct and Efficient Work-Stealing for Weak Memory Models" by Lê,
+/// Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+///
+/// When the buffer is full it is replaced by one twice as large. Old buffers
+/// may still be read by a concurrent `steal()` so they are kept alive until the
+/// deque is destroyed.
+class WorkDeque final {
+ public:
+  WorkDeque() noexcept : buffer_(new Buffer(INITIAL_CAPACITY, nullptr)) {}
+  ~WorkDeque() noexcept {
+    Buffer* b = buffer_.load(std::memory_order_relaxed);
+    while (b) {
+      Buffer* retired = b->retired;
+      delete b;
+      b = retired;
+    }
+  }
+
+  WorkDeque(WorkDeque&&) = delete;
+  WorkDeque& operator=(WorkDeque&&) = delete;
+
+  /// Pushes a job at the bottom. Must only be called by the owning thread.
+  void push(Job* job) noexcept {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Buffer* buf = buffer_.load(std::memory_order_relaxed);
+    if (b - t > buf->mask) buf = grow(buf, t, b);
+    buf->put(b, job);
+    // Publishes the job to thieves, which read `bottom_` with acquire.
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  /// Pops the most recently pushed job from the bottom, or returns null if the
+  /// deque is empty. Must only be called by the owning thread.
+  Job* pop() noexcept {
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buf = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Job* job = buf->get(b);
+    if (t == b) {
+      // The last job, which a thief may be racing to steal.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        job = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+  }
+
+  /// Steals the oldest job from the top, or returns null if the deque is empty
+  /// or another thread won the race for the job. May be called from any thread.
+  Job* steal() noexcept {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+    Buffer* buf = buffer_.load(std::memory_order_acquire);
+    Job* job = buf->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return job;
+  }
+
+  /// Returns true if the deque looks empty. The result may be stale as soon as
+  /// it is returned when other threads are using the deque.
+  bool is_empty() const noexcept {
+    return bottom_.load(std::memory_order_relaxed) <=
+           top_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr int64_t INITIAL_CAPACITY = 64;
+
+  struct Buffer {
+    Buffer(int64_t capacity, Buffer* retired) noexcept
+        : mask(capacity - 1),
+          slots(new std::atomic<Job*>[static_cast<size_t>(capacity)]),
+          retired(retired) {}
+    ~Buffer() noexcept { delete[] slots; }
+
+    Job* get(int64_t i) const noexcept {
+      return slots[i & mask].load(std::memory_order_relaxed);
+    }
+    void put(int64_t i, Job* job) noexcept {
+      slots[i & mask].store(job, std::memory_order_relaxed);
+    }
+
+    int64_t mask;
+    std::atomic<Job*>* slots;
+    // The previous, smaller, buffer which is kept alive for thieves.
+    Buffer* retired;
+  };
+
+  Buffer* grow(Buffer* old, int64_t top, int64_t bottom) noexcept {
+    auto* buf = new Buffer((old->mask + 1) * 2, old);
+    for (int64_t i = top; i < bottom; ++i) buf->put(i, old->get(i));
+    buffer_.store(buf, std::memory_order_release);
+    return buf;
+  }
+
+  // Thieves take from the `top_` and the owner pushes and pops at the
+  // `bottom_`.
+  std::atomic<int64_t> top_ = 0;
+  std::atomic<int64_t> bottom_ = 0;
+  std::atomic<Buffer*> buffer_;
+};
+
+}  // namespace sus::thread::__private
@@ -0,0 +1,111 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/thread/__private/work_deque.h"
+
+#include <atomic>
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::thread::__private::Job;
+using sus::thread::__private::WorkDeque;
+
+void noop(Job*) noexcept {}
+
+sus::Vec<Job> make_jobs(usize n) {
+  auto v = sus::Vec<Job>::with_capacity(n);
+  for (usize i; i < n; i += 1u) v.push(Job(&noop));
+  return v;
+}
+
+TEST(WorkDeque, PopIsLifo) {
+  auto jobs = make_jobs(3u);
+  WorkDeque d;
+  EXPECT_TRUE(d.is_empty());
+  EXPECT_EQ(d.pop(), nullptr);
+  d.push(&jobs[0u]);
+  d.push(&jobs[1u]);
+  d.push(&jobs[2u]);
+  EXPECT_FALSE(d.is_empty());
+  EXPECT_EQ(d.pop(), &jobs[2u]);
+  EXPECT_EQ(d.pop(), &jobs[1u]);
+  EXPECT_EQ(d.pop(), &jobs[0u]);
+  EXPECT_EQ(d.pop(), nullptr);
+  EXPECT_TRUE(d.is_empty());
+}
+
+TEST(WorkDeque, StealIsFifo) {
+  auto jobs = make_jobs(3u);
+  WorkDeque d;
+  EXPECT_EQ(d.steal(), nullptr);
+  d.push(&jobs[0u]);
+  d.push(&jobs[1u]);
+  d.push(&jobs[2u]);
+  EXPECT_EQ(d.steal(), &jobs[0u]);
+  EXPECT_EQ(d.pop(), &jobs[2u]);
+  EXPECT_EQ(d.steal(), &jobs[1u]);
+  EXPECT_EQ(d.steal(), nullptr);
+  EXPECT_EQ(d.pop(), nullptr);
+}
+
+TEST(WorkDeque, Grow) {
+  auto jobs = make_jobs(1000u);
+  WorkDeque d;
+  for (Job& j : jobs.iter_mut()) d.push(&j);
+  EXPECT_EQ(d.steal(), &jobs[0u]);
+  for (usize i = 999u; i > 0u; i -= 1u) EXPECT_EQ(d.pop(), &jobs[i]);
+  EXPECT_EQ(d.pop(), nullptr);
+}
+
+TEST(WorkDeque, ConcurrentSteal) {
+  auto jobs = make_jobs(10'000u);
+  WorkDeque d;
+  auto done = std::atomic<bool>(false);
+
+  // Each thread records the jobs it took, and every job must be taken exactly
+  // once across all the threads.
+  auto taken = sus::Vec<sus::Vec<Job*>>(sus::Vec<Job*>(), sus::Vec<Job*>(),
+                                        sus::Vec<Job*>(), sus::Vec<Job*>());
+  auto thieves = sus::Vec<std::thread>();
+  for (usize i = 1u; i < taken.len(); i += 1u) {
+    thieves.push(std::thread([&d, &done, &taken_by_me = taken[i]]() {
+      while (!done.load()) {
+        if (Job* j = d.steal(); j != nullptr) taken_by_me.push(j);
+      }
+    }));
+  }
+  for (usize i; i < jobs.len(); i += 1u) {
+    d.push(&jobs[i]);
+    if (i % 3u == 0u) {
+      if (Job* j = d.pop(); j != nullptr) taken[0u].push(j);
+    }
+  }
+  while (!d.is_empty()) std::this_thread::yield();
+  done.store(true);
+  for (std::thread& t : thieves.iter_mut()) t.join();
+  while (Job* j = d.pop()) taken[0u].push(j);
+
+  auto all = sus::Vec<Job*>();
+  for (sus::Vec<Job*>& v : taken.iter_mut()) all.extend(sus::move(v));
+  all.sort();
+  ASSERT_EQ(all.len(), jobs.len());
+  for (usize i; i < jobs.len(); i += 1u) EXPECT_EQ(all[i], &jobs[i]);
+}
+
+}  // namespace
@@ -0,0 +1,325 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/thread/thread_pool.h"
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "sus/assertions/check.h"
+#include "sus/boxed/box.h"
+#include "sus/cmp/ord.h"
+#include "sus/collections/vec.h"
+#include "sus/mem/replace.h"
+#include "sus/num/types.h"
+#include "sus/thread/__private/work_deque.h"
+
+using sus::boxed::Box;
+using sus::collections::Vec;
+using sus::num::u32;
+using sus::num::usize;
+using sus::option::Option;
+using sus::thread::__private::Job;
+using sus::thread::__private::WorkDeque;
+
+namespace sus::thread {
+
+namespace __private {
+
+class Registry final {
+ public:
+  explicit Registry(usize num_threads) noexcept {
+    // The deques must all exist before any thread starts stealing from them.
+    for (usize i; i < num_threads; i += 1u)
+      deques_.push(Box<WorkDeque>::with_default());
+    for (usize i; i < num_threads; i += 1u)
+      threads_.push(std::thread([this, i]() { main_loop(i); }));
+  }
+
+  /// Waits for the queued jobs to be run, then stops the worker threads.
+  ~Registry() noexcept {
+    shutdown_.store(true, std::memory_order_seq_cst);
+    {
+      auto lock = std::unique_lock(sleep_mutex_);
+      sleep_cv_.notify_all();
+    }
+    for (std::thread& t : threads_.iter_mut()) t.join();
+  }
+
+  usize num_threads() const noexcept { return deques_.len(); }
+
+  Option<usize> current_thread_index() const noexcept;
+
+  void push_local(usize index, Job* job) noexcept {
+    deques_[index]->push(job);
+    notify();
+  }
+
+  Job* pop_local(usize index) noexcept { return deques_[index]->pop(); }
+
+  void inject(Job* job) noexcept {
+    {
+      auto lock = std::unique_lock(inject_mutex_);
+      injected_.push_back(job);
+    }
+    notify();
+  }
+
+  /// Runs a job on a worker thread, and wakes any threads waiting for a job
+  /// to complete, since it may be the one they are waiting for.
+  void run(Job* job) noexcept {
+    job->execute();
+    // Pairs with the increment of `waiters_` in `execute_until()`, so either
+    // the waiter sees its `done` flag set or this sees the waiter.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) > 0u) {
+      auto lock = std::unique_lock(sleep_mutex_);
+      wait_cv_.notify_all();
+    }
+  }
+
+  void execute_until(usize index, const std::atomic<bool>& done) noexcept {
+    u32 idle_rounds;
+    while (!done.load(std::memory_order_acquire)) {
+      const uint64_t seen_epoch = epoch_.load(std::memory_order_seq_cst);
+      if (Job* job = find_work(index); job != nullptr) {
+        run(job);
+        idle_rounds = 0u;
+        continue;
+      }
+      // The job being waited for is likely to complete soon, so spin for a
+      // short while before going to sleep.
+      if (idle_rounds < SpinRounds) {
+        idle_rounds += 1u;
+        std::this_thread::yield();
+        continue;
+      }
+      // Sleep until a job completes on another thread, which may set `done`,
+      // or until new work is queued.
+      auto lock = std::unique_lock(sleep_mutex_);
+      waiters_.fetch_add(1u, std::memory_order_seq_cst);
+      wait_cv_.wait(lock, [&]() {
+        return done.load(std::memory_order_seq_cst) ||
+               epoch_.load(std::memory_order_seq_cst) != seen_epoch;
+      });
+      waiters_.fetch_sub(1u, std::memory_order_relaxed);
+      idle_rounds = 0u;
+    }
+  }
+
+ private:
+  /// Finds a job for the worker at `index` to run: its own most recent job
+  /// first, then the oldest job of another worker, and then jobs injected from
+  /// outside the pool.
+  Job* find_work(usize index) noexcept {
+    if (Job* job = deques_[index]->pop(); job != nullptr) return job;
+    const usize n = deques_.len();
+    for (usize i = 1u; i < n; i += 1u) {
+      if (Job* job = deques_[(index + i) % n]->steal(); job != nullptr)
+        return job;
+    }
+    auto lock = std::unique_lock(inject_mutex_);
+    if (injected_.empty()) return nullptr;
+    Job* job = injected_.front();
+    injected_.pop_front();
+    return job;
+  }
+
+  /// Wakes a sleeping worker, if there is one, after new work was queued.
+  /// Otherwise wakes a thread which is waiting in `execute_until()`, so that
+  /// it can run the work while it waits.
+  void notify() noexcept {
+    epoch_.fetch_add(1u, std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_seq_cst) > 0u) {
+      auto lock = std::unique_lock(sleep_mutex_);
+      sleep_cv_.notify_one();
+    } else if (waiters_.load(std::memory_order_seq_cst) > 0u) {
+      auto lock = std::unique_lock(sleep_mutex_);
+      wait_cv_.notify_one();
+    }
+  }
+
+  void main_loop(usize index) noexcept;
+
+  Vec<Box<WorkDeque>> deques_;
+  Vec<std::thread> threads_;
+
+  std::mutex inject_mutex_;
+  std::deque<Job*> injected_;
+
+  // The number of times `execute_until()` looks for work before it sleeps.
+  static constexpr u32 SpinRounds = 64u;
+
+  std::mutex sleep_mutex_;
+  // Idle workers sleep on `sleep_cv_` until new work is queued.
+  std::condition_variable sleep_cv_;
+  // Workers waiting for a job in `execute_until()` sleep on `wait_cv_` until a
+  // job completes or new work is queued.
+  std::condition_variable wait_cv_;
+  // Incremented each time a job is queued, so that a worker which found no
+  // work can tell if new work arrived before it went to sleep. A worker
+  // increments `sleepers_` before checking `epoch_` one last time, and
+  // `notify()` increments `epoch_` before checking `sleepers_`, so one of them
+  // always sees the other.
+  std::atomic<uint64_t> epoch_ = 0u;
+  std::atomic<uint32_t> sleepers_ = 0u;
+  std::atomic<uint32_t> waiters_ = 0u;
+  std::atomic<bool> shutdown_ = false;
+};
+
+namespace {
+
+thread_local const Registry* tls_registry = nullptr;
+thread_local usize tls_worker_index;
+
+/// Wraps a job injected from outside the pool, so the injecting thread can
+/// block until it is complete.
+struct LatchJob final : public Job {
+  explicit LatchJob(Job* job) noexcept : Job(&LatchJob::run), job(job) {}
+
+  static void run(Job* j) noexcept {
+    auto& self = *static_cast<LatchJob*>(j);
+    self.job->execute();
+    // The notify happens under the lock, as the waiting thread destroys the
+    // LatchJob as soon as it sees `done`.
+    auto lock = std::unique_lock(self.mutex);
+    self.done = true;
+    self.cv.notify_all();
+  }
+
+  Job* job;
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool done = false;
+};
+
+}  // namespace
+
+Option<usize> Registry::current_thread_index() const noexcept {
+  if (tls_registry == this) return Option<usize>(tls_worker_index);
+  return Option<usize>();
+}
+
+void Registry::main_loop(usize index) noexcept {
+  tls_registry = this;
+  tls_worker_index = index;
+  while (true) {
+    const uint64_t seen_epoch = epoch_.load(std::memory_order_seq_cst);
+    if (Job* job = find_work(index); job != nullptr) {
+      run(job);
+      continue;
+    }
+    // Exit only once there's no work left, so spawned tasks are all run.
+    if (shutdown_.load(std::memory_order_seq_cst)) return;
+
+    auto lock = std::unique_lock(sleep_mutex_);
+    sleepers_.fetch_add(1u, std::memory_order_seq_cst);
+    sleep_cv_.wait(lock, [&]() {
+      return epoch_.load(std::memory_order_seq_cst) != seen_epoch ||
+             shutdown_.load(std::memory_order_seq_cst);
+    });
+    sleepers_.fetch_sub(1u, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace __private
+
+ThreadPool ThreadPool::with_num_threads(usize num_threads) noexcept {
+  sus_check_with_message(num_threads > 0u,
+                         "ThreadPool requires at least one thread");
+  return ThreadPool(new __private::Registry(num_threads));
+}
+
+ThreadPool ThreadPool::with_default_num_threads() noexcept {
+  return with_num_threads(::sus::cmp::max(
+      usize::from(std::thread::hardware_concurrency()), 1_usize));
+}
+
+ThreadPool& ThreadPool::global() noexcept {
+  static ThreadPool pool = with_default_num_threads();
+  return pool;
+}
+
+ThreadPool::~ThreadPool() noexcept { delete registry_; }
+
+ThreadPool::ThreadPool(ThreadPool&& rhs) noexcept
+    : registry_(::sus::mem::replace(rhs.registry_, nullptr)) {}
+
+ThreadPool& ThreadPool::operator=(ThreadPool&& rhs) noexcept {
+  if (this != &rhs) {
+    delete registry_;
+    registry_ = ::sus::mem::replace(rhs.registry_, nullptr);
+  }
+  return *this;
+}
+
+usize ThreadPool::num_threads() const noexcept {
+  sus_check_with_message(registry_ != nullptr, "ThreadPool used after move");
+  return registry_->num_threads();
+}
+
+Option<usize> ThreadPool::current_thread_index() const noexcept {
+  sus_check_with_message(registry_ != nullptr, "ThreadPool used after move");
+  return registry_->current_thread_index();
+}
+
+void ThreadPool::push_local(usize index, Job* job) noexcept {
+  registry_->push_local(index, job);
+}
+
+Job* ThreadPool::pop_local(usize index) noexcept {
+  return registry_->pop_local(index);
+}
+
+void ThreadPool::execute_until(usize index,
+                               const std::atomic<bool>& done) noexcept {
+  registry_->execute_until(index, done);
+}
+
+void ThreadPool::execute(Job* job) noexcept { registry_->run(job); }
+
+void ThreadPool::wait_until(__private::Registry* registry,
+                            const std::atomic<bool>& done) noexcept {
+  // A pool is only destroyed once all of its jobs have run, so the `registry`
+  // is not used if the job is already done.
+  if (done.load(std::memory_order_acquire)) return;
+  if (Option<usize> index = registry->current_thread_index();
+      index.is_some()) {
+    registry->execute_until(*index, done);
+  } else {
+    while (!done.load(std::memory_order_acquire))
+      done.wait(false, std::memory_order_acquire);
+  }
+}
+
+void ThreadPool::run_cold(Job* job) noexcept {
+  auto latch = __private::LatchJob(job);
+  registry_->inject(&latch);
+  auto lock = std::unique_lock(latch.mutex);
+  latch.cv.wait(lock, [&]() { return latch.done; });
+}
+
+void ThreadPool::push(Job* job) noexcept {
+  sus_check_with_message(registry_ != nullptr, "ThreadPool used after move");
+  if (Option<usize> index = registry_->current_thread_index(); index.is_some())
+    registry_->push_local(*index, job);
+  else
+    registry_->inject(job);
+}
+
+}  // namespace sus::thread
@@ -0,0 +1,377 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <atomic>
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+#include "sus/thread/__private/job.h"
+#include "sus/tuple/tuple.h"
+
+namespace sus {
+
+/// Running work concurrently on a pool of threads.
+///
+/// A [`ThreadPool`]($sus::thread::ThreadPool) owns a set of worker threads
+/// which run tasks with work-stealing: each worker keeps its own queue of
+/// tasks, and workers which run out of tasks steal from the others. The
+/// [`global`]($sus::thread::ThreadPool::global) pool is used for
+/// [parallel iteration]($sus::iter::par).
+namespace thread {}
+
+}  // namespace sus
+
+namespace sus::thread {
+
+class ThreadPool;
+
+namespace __private {
+class Registry;
+template <class F>
+struct ScopeJob;
+}  // namespace __private
+
+/// A scope in which tasks can be spawned which borrow from the stack of the
+/// caller of [`ThreadPool::scope`]($sus::thread::ThreadPool::scope).
+///
+/// The `scope()` call does not return until every task spawned into the scope
+/// has completed, so the tasks may hold references to anything that outlives
+/// the `scope()` call.
+class Scope final {
+ public:
+  /// Spawns a task into the scope, which will run on one of the pool's
+  /// threads. The task is given the `Scope` so that it can spawn more tasks.
+  ///
+  /// The task may be any closure satisfying `FnOnce<void(Scope&)>`, including
+  /// a type-erased [`Box`]($sus::boxed::Box)`<DynFnOnce<void(Scope&)>>`.
+  template <::sus::fn::FnOnce<void(Scope&)> F>
+    requires(std::is_move_constructible_v<F>)
+  void spawn(F task) noexcept;
+
+  Scope(Scope&&) = delete;
+  Scope& operator=(Scope&&) = delete;
+
+ private:
+  friend class ThreadPool;
+  template <class F>
+  friend struct __private::ScopeJob;
+
+  explicit Scope(ThreadPool& pool) noexcept : pool_(pool) {}
+
+  /// Marks a spawned task, or the scope's own closure, as complete.
+  void complete_one() noexcept {
+    if (pending_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+      done_.store(true, std::memory_order_release);
+  }
+
+  ThreadPool& pool_;
+  // The number of spawned tasks which are not complete, plus one for the
+  // scope's own closure while it runs.
+  std::atomic<size_t> pending_ = 1u;
+  std::atomic<bool> done_ = false;
+};
+
+/// A handle to a task given to
+/// [`ThreadPool::spawn`]($sus::thread::ThreadPool::spawn), through which the
+/// result of the task can be received.
+///
+/// Destroying the handle detaches it from the task, which still runs to
+/// completion, and its result is dropped.
+template <class R>
+class JoinHandle final {
+ public:
+  ~JoinHandle() noexcept {
+    if (state_ != nullptr) state_->release();
+  }
+
+  /// Type is Move, but not Copy or Clone.
+  JoinHandle(JoinHandle&& rhs) noexcept
+      : registry_(rhs.registry_),
+        state_(::sus::mem::replace(rhs.state_, nullptr)) {}
+  JoinHandle& operator=(JoinHandle&& rhs) noexcept {
+    if (state_ != nullptr) state_->release();
+    registry_ = rhs.registry_;
+    state_ = ::sus::mem::replace(rhs.state_, nullptr);
+    return *this;
+  }
+
+  /// Returns whether the task has run to completion, without blocking.
+  ///
+  /// # Panics
+  /// Panics if the `JoinHandle` was moved-from.
+  bool is_finished() const noexcept {
+    sus_check_with_message(state_ != nullptr, "JoinHandle used after move");
+    return state_->done.load(std::memory_order_acquire);
+  }
+
+  /// Waits for the task to complete, and returns its result.
+  ///
+  /// The result can only be received once, and `None` is returned if it was
+  /// already taken by an earlier call to `join()`. For a task which returns
+  /// `void`, this only waits for the task to complete.
+  ///
+  /// When called on one of the pool's worker threads, the worker runs other
+  /// tasks while it waits.
+  ///
+  /// # Panics
+  /// Panics if the `JoinHandle` was moved-from.
+  auto join() noexcept;
+
+ private:
+  friend class ThreadPool;
+
+  JoinHandle(__private::Registry* registry,
+             __private::TaskState<R>* state) noexcept
+      : registry_(registry), state_(state) {}
+
+  // The pool's state, which is not moved along with the `ThreadPool`.
+  __private::Registry* registry_;
+  // Null once the `JoinHandle` is moved-from.
+  __private::TaskState<R>* state_;
+};
+
+/// A pool of worker threads which run tasks with work-stealing.
+///
+/// Work is given to the pool in three ways:
+/// * [`spawn`]($sus::thread::ThreadPool::spawn) runs a task asynchronously,
+///   and returns a [`JoinHandle`]($sus::thread::JoinHandle) to receive its
+///   result. The task must own everything it uses.
+/// * [`join`]($sus::thread::ThreadPool::join) runs two closures, potentially in
+///   parallel, and returns both results. The closures may borrow from the
+///   caller's stack.
+/// * [`scope`]($sus::thread::ThreadPool::scope) runs a closure that may spawn
+///   any number of tasks which borrow from the caller's stack, and waits for
+///   them all.
+///
+/// Each worker thread has a Chase-Lev deque of tasks. A worker pushes and pops
+/// tasks at the back of its own deque, which keeps recently created work (and
+/// its data) on the same thread, while idle workers steal the oldest tasks from
+/// the front of other workers' deques. Tasks given to the pool from outside of
+/// it are placed in a shared queue.
+///
+/// When `join()` or `scope()` is called from a worker thread, the worker runs
+/// other tasks while it waits, rather than blocking. When called from a thread
+/// outside the pool, the work is moved into the pool and the calling thread
+/// blocks until it is done.
+///
+/// Destroying the `ThreadPool` waits for all spawned tasks to complete, then
+/// stops and joins its threads.
+class ThreadPool final {
+ public:
+  /// Constructs a `ThreadPool` with `num_threads` worker threads.
+  ///
+  /// # Panics
+  /// Panics if `num_threads` is zero.
+  static ThreadPool with_num_threads(usize num_threads) noexcept;
+
+  /// Constructs a `ThreadPool` with one worker thread for each hardware thread
+  /// in the system.
+  static ThreadPool with_default_num_threads() noexcept;
+
+  /// Returns the global `ThreadPool`, which has one worker thread for each
+  /// hardware thread in the system. It is started on first use, and is used to
+  /// run [parallel iterators]($sus::iter::par).
+  static ThreadPool& global() noexcept;
+
+  ~ThreadPool() noexcept;
+
+  /// Type is Move, but not Copy or Clone.
+  ThreadPool(ThreadPool&& rhs) noexcept;
+  ThreadPool& operator=(ThreadPool&& rhs) noexcept;
+
+  /// Returns the number of worker threads in the pool.
+  usize num_threads() const noexcept;
+
+  /// Returns the index of the current thread in the pool, from `0` up to
+  /// `num_threads() - 1`, or `None` if the current thread is not one of the
+  /// pool's worker threads.
+  Option<usize> current_thread_index() const noexcept;
+
+  /// Runs `task` asynchronously on one of the pool's threads.
+  ///
+  /// The task may be any closure satisfying `FnOnce<R()>`, including a
+  /// type-erased [`Box`]($sus::boxed::Box)`<DynFnOnce<R()>>`. Its result is
+  /// received through [`JoinHandle::join`]($sus::thread::JoinHandle::join) on
+  /// the returned handle, which may also be dropped to detach the task.
+  template <::sus::fn::FnOnce<::sus::fn::Anything()> F>
+    requires(std::is_move_constructible_v<F>)
+  JoinHandle<::sus::fn::ReturnOnce<F>> spawn(F task) noexcept {
+    auto* job = new __private::HeapJob<F>(::sus::move(task));
+    push(job);
+    return JoinHandle<::sus::fn::ReturnOnce<F>>(registry_, job);
+  }
+
+  /// Runs the closures `a` and `b`, potentially in parallel, and returns their
+  /// results once both are complete.
+  ///
+  /// The closure `b` is made available for other threads to steal while the
+  /// current thread runs `a`. If it was not stolen by the time `a` completes,
+  /// the current thread runs `b` as well. This makes `join()` cheap enough to
+  /// use for recursive divide-and-conquer algorithms.
+  template <::sus::fn::FnOnce<::sus::fn::NonVoid()> A,
+            ::sus::fn::FnOnce<::sus::fn::NonVoid()> B>
+  ::sus::Tuple<::sus::fn::ReturnOnce<A>, ::sus::fn::ReturnOnce<B>> join(
+      A a, B b) noexcept {
+    using RA = ::sus::fn::ReturnOnce<A>;
+    using RB = ::sus::fn::ReturnOnce<B>;
+
+    const Option<usize> index = current_thread_index();
+    if (index.is_none()) [[unlikely]] {
+      auto cold = [&]() { return join(::sus::move(a), ::sus::move(b)); };
+      auto job = __private::StackJob<decltype(cold)>(cold);
+      run_cold(&job);
+      return ::sus::move(job.result).unwrap_unchecked(::sus::marker::unsafe_fn);
+    }
+    const usize i = *index;
+
+    auto job_b = __private::StackJob<B>(b);
+    push_local(i, &job_b);
+    RA ra = ::sus::fn::call_once(::sus::move(a));
+    // Run jobs from the local deque until `job_b` is complete. If `job_b` was
+    // not stolen then it's the first job popped, and running it here completes
+    // it.
+    while (!job_b.done.load(std::memory_order_acquire)) {
+      __private::Job* job = pop_local(i);
+      if (job == nullptr) {
+        execute_until(i, job_b.done);
+        break;
+      }
+      execute(job);
+    }
+    return ::sus::Tuple<RA, RB>(
+        ::sus::move(ra),
+        ::sus::move(job_b.result).unwrap_unchecked(::sus::marker::unsafe_fn));
+  }
+
+  /// Runs the closure `f` with a [`Scope`]($sus::thread::Scope) into which it
+  /// can spawn tasks that borrow from the current stack, and returns the
+  /// result of `f` once all the spawned tasks are complete.
+  template <::sus::fn::FnOnce<::sus::fn::Anything(Scope&)> F>
+  ::sus::fn::ReturnOnce<F, Scope&> scope(F f) noexcept {
+    using R = ::sus::fn::ReturnOnce<F, Scope&>;
+
+    const Option<usize> index = current_thread_index();
+    if (index.is_none()) [[unlikely]] {
+      if constexpr (std::is_void_v<R>) {
+        auto cold = [&]() {
+          scope(::sus::move(f));
+          return true;
+        };
+        auto job = __private::StackJob<decltype(cold)>(cold);
+        run_cold(&job);
+        return;
+      } else {
+        auto cold = [&]() { return scope(::sus::move(f)); };
+        auto job = __private::StackJob<decltype(cold)>(cold);
+        run_cold(&job);
+        return ::sus::move(job.result).unwrap_unchecked(
+            ::sus::marker::unsafe_fn);
+      }
+    }
+    const usize i = *index;
+
+    auto s = Scope(*this);
+    if constexpr (std::is_void_v<R>) {
+      ::sus::fn::call_once(::sus::move(f), s);
+      s.complete_one();
+      execute_until(i, s.done_);
+    } else {
+      R r = ::sus::fn::call_once(::sus::move(f), s);
+      s.complete_one();
+      execute_until(i, s.done_);
+      return r;
+    }
+  }
+
+ private:
+  friend class Scope;
+  template <class R>
+  friend class JoinHandle;
+
+  explicit ThreadPool(__private::Registry* registry) noexcept
+      : registry_(registry) {}
+
+  /// Pushes a job onto the deque of the worker thread at `index`, which must be
+  /// the current thread.
+  void push_local(usize index, __private::Job* job) noexcept;
+  /// Pops the most recently pushed job from the deque of the worker thread at
+  /// `index`, which must be the current thread. Returns null if there is none.
+  __private::Job* pop_local(usize index) noexcept;
+  /// Runs a job popped from the current worker thread's deque.
+  void execute(__private::Job* job) noexcept;
+  /// Runs jobs on the worker thread at `index`, which must be the current
+  /// thread, until `done` is set.
+  void execute_until(usize index, const std::atomic<bool>& done) noexcept;
+  /// Waits until `done` is set. A worker thread of the pool with `registry`
+  /// runs other jobs while it waits, and any other thread blocks.
+  static void wait_until(__private::Registry* registry,
+                         const std::atomic<bool>& done) noexcept;
+  /// Runs `job` on a worker thread and blocks the current thread, which must
+  /// not be a worker thread, until it is complete.
+  void run_cold(__private::Job* job) noexcept;
+  /// Pushes a job onto the current worker thread's deque if the current thread
+  /// is in the pool, or to the shared queue otherwise.
+  void push(__private::Job* job) noexcept;
+
+  __private::Registry* registry_;
+};
+
+namespace __private {
+
+/// A job for a task given to `Scope::spawn()`, which owns the task and deletes
+/// itself once it has run, then marks the task complete in its `Scope`.
+template <class F>
+struct ScopeJob final : public Job {
+  ScopeJob(F&& f, Scope& scope) noexcept
+      : Job(&ScopeJob::run), f(::sus::move(f)), scope(scope) {}
+
+  static void run(Job* job) noexcept {
+    auto* self = static_cast<ScopeJob*>(job);
+    Scope& scope = self->scope;
+    ::sus::fn::call_once(::sus::move(self->f), scope);
+    delete self;
+    scope.complete_one();
+  }
+
+  F f;
+  Scope& scope;
+};
+
+}  // namespace __private
+
+template <class R>
+auto JoinHandle<R>::join() noexcept {
+  sus_check_with_message(state_ != nullptr, "JoinHandle used after move");
+  ThreadPool::wait_until(registry_, state_->done);
+  if constexpr (!std::is_void_v<R>) return state_->result.take();
+}
+
+template <::sus::fn::FnOnce<void(Scope&)> F>
+  requires(std::is_move_constructible_v<F>)
+void Scope::spawn(F task) noexcept {
+  pending_.fetch_add(1u, std::memory_order_relaxed);
+  pool_.push(new __private::ScopeJob<F>(::sus::move(task), *this));
+}
+
+}  // namespace sus::thread
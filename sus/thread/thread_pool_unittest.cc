@@ -0,0 +1,250 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/thread/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/boxed/box.h"
+#include "sus/collections/vec.h"
+#include "sus/fn/fn_dyn.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::boxed::Box;
+using sus::fn::DynFnOnce;
+using sus::thread::Scope;
+using sus::thread::ThreadPool;
+
+u64 fib(ThreadPool& pool, u64 n) {
+  if (n < 2u) return n;
+  auto [a, b] = pool.join([&]() { return fib(pool, n - 1u); },
+                          [&]() { return fib(pool, n - 2u); });
+  return a + b;
+}
+
+TEST(ThreadPool, NumThreads) {
+  auto pool = ThreadPool::with_num_threads(3u);
+  EXPECT_EQ(pool.num_threads(), 3u);
+  EXPECT_GE(ThreadPool::global().num_threads(), 1u);
+}
+
+TEST(ThreadPool, CurrentThreadIndex) {
+  auto pool = ThreadPool::with_num_threads(2u);
+  EXPECT_EQ(pool.current_thread_index(), sus::none());
+
+  auto [in_pool, in_other_pool] = pool.join(
+      [&]() { return pool.current_thread_index(); },
+      [&]() { return ThreadPool::global().current_thread_index(); });
+  EXPECT_TRUE(in_pool.is_some());
+  EXPECT_LT(*in_pool, 2u);
+  EXPECT_EQ(in_other_pool, sus::none());
+}
+
+TEST(ThreadPool, Join) {
+  auto pool = ThreadPool::with_num_threads(4u);
+  auto [a, b] = pool.join([]() { return 1_i32; }, []() { return 2_u8; });
+  EXPECT_EQ(a, 1_i32);
+  EXPECT_EQ(b, 2_u8);
+}
+
+TEST(ThreadPool, JoinRecursive) {
+  auto pool = ThreadPool::with_num_threads(4u);
+  EXPECT_EQ(fib(pool, 20u), 6765u);
+  // From inside the pool, the join happens on the worker thread.
+  auto [r, unused] = pool.join([&]() { return fib(pool, 15u); },
+                               []() { return 0_u64; });
+  EXPECT_EQ(r, 610u);
+}
+
+TEST(ThreadPool, JoinMoveOnly) {
+  auto pool = ThreadPool::with_num_threads(2u);
+  auto x = Box<i32>(3);
+  auto [a, b] = pool.join(
+      [x = sus::move(x)]() mutable { return sus::move(x); },
+      []() { return Box<i32>(4); });
+  EXPECT_EQ(*a, 3);
+  EXPECT_EQ(*b, 4);
+}
+
+TEST(ThreadPool, Scope) {
+  auto pool = ThreadPool::with_num_threads(4u);
+  auto v = sus::Vec<i32>(0, 0, 0, 0, 0, 0, 0, 0);
+  pool.scope([&](Scope& s) {
+    for (auto& i : v.iter_mut()) {
+      s.spawn([&i](Scope&) { i += 1; });
+    }
+  });
+  EXPECT_EQ(v, sus::Vec<i32>(1, 1, 1, 1, 1, 1, 1, 1));
+}
+
+TEST(ThreadPool, ScopeNestedSpawn) {
+  auto pool = ThreadPool::with_num_threads(4u);
+  auto count = std::atomic<int>(0);
+  i32 r = pool.scope([&](Scope& s) {
+    for (usize i; i < 10u; i += 1u) {
+      s.spawn([&count](Scope& inner) {
+        count.fetch_add(1);
+        for (usize j; j < 10u; j += 1u) {
+          inner.spawn([&count](Scope&) { count.fetch_add(1); });
+        }
+      });
+    }
+    return 7_i32;
+  });
+  EXPECT_EQ(r, 7_i32);
+  EXPECT_EQ(count.load(), 110);
+}
+
+TEST(ThreadPool, Spawn) {
+  auto count = std::atomic<int>(0);
+  {
+    auto pool = ThreadPool::with_num_threads(4u);
+    for (usize i; i < 100u; i += 1u) {
+      pool.spawn([&count]() { count.fetch_add(1); });
+    }
+    // Destroying the pool waits for the spawned tasks.
+  }
+  EXPECT_EQ(count.load(), 100);
+}
+
+std::atomic<int> boxed_count;
+void increment_boxed_count() { boxed_count.fetch_add(1); }
+
+TEST(ThreadPool, SpawnDyn) {
+  {
+    auto pool = ThreadPool::with_num_threads(2u);
+    pool.spawn(Box<DynFnOnce<void()>>::from(&increment_boxed_count));
+    pool.spawn(Box<DynFnOnce<void()>>::from(&increment_boxed_count));
+  }
+  EXPECT_EQ(boxed_count.load(), 2);
+}
+
+TEST(ThreadPool, SpawnFromWorker) {
+  auto count = std::atomic<int>(0);
+  {
+    auto pool = ThreadPool::with_num_threads(2u);
+    pool.spawn([&pool, &count]() {
+      for (usize i; i < 10u; i += 1u) {
+        pool.spawn([&count]() { count.fetch_add(1); });
+      }
+    });
+  }
+  EXPECT_EQ(count.load(), 10);
+}
+
+TEST(ThreadPool, SpawnJoinHandle) {
+  auto pool = ThreadPool::with_num_threads(2u);
+  auto handle = pool.spawn([]() { return Box<i32>(5); });
+  sus::Option<Box<i32>> r = handle.join();
+  EXPECT_TRUE(handle.is_finished());
+  EXPECT_EQ(**r, 5);
+  // The result can only be received once.
+  EXPECT_EQ(handle.join().is_none(), true);
+
+  auto boxed = pool.spawn(Box<DynFnOnce<i32()>>::from([]() { return 3_i32; }));
+  EXPECT_EQ(boxed.join(), sus::some(3_i32));
+
+  auto count = std::atomic<int>(0);
+  auto unit = pool.spawn([&count]() { count.fetch_add(1); });
+  static_assert(std::same_as<decltype(unit.join()), void>);
+  unit.join();
+  EXPECT_EQ(count.load(), 1);
+}
+
+TEST(ThreadPool, SpawnJoinFromWorker) {
+  auto pool = ThreadPool::with_num_threads(1u);
+  // With a single worker, the task can only run if the worker runs it while
+  // waiting in `join()`.
+  auto outer = pool.spawn([&pool]() {
+    auto inner = pool.spawn([]() { return 2_u32; });
+    return inner.join().unwrap() + 1u;
+  });
+  EXPECT_EQ(outer.join(), sus::some(3_u32));
+}
+
+TEST(ThreadPool, SpawnDetached) {
+  auto count = std::atomic<int>(0);
+  {
+    auto pool = ThreadPool::with_num_threads(2u);
+    for (usize i; i < 10u; i += 1u) {
+      // Dropping the handle detaches the task, which still runs.
+      pool.spawn([&count]() {
+        count.fetch_add(1);
+        return 1_i32;
+      });
+    }
+  }
+  EXPECT_EQ(count.load(), 10);
+}
+
+TEST(ThreadPool, JoinWaitsForSlowTask) {
+  auto pool = ThreadPool::with_num_threads(2u);
+  auto stolen = std::atomic<bool>(false);
+  // The first closure waits until the second is stolen, then returns while the
+  // second is still running, so the joining worker runs out of work and goes
+  // to sleep until the second completes.
+  auto [a, b] = pool.join(
+      [&]() {
+        while (!stolen.load()) std::this_thread::yield();
+        return 1_i32;
+      },
+      [&]() {
+        stolen.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return 2_i32;
+      });
+  EXPECT_EQ(a + b, 3_i32);
+
+  // A scope waits for long tasks without holding up the pool.
+  auto count = std::atomic<int>(0);
+  pool.scope([&](Scope& s) {
+    s.spawn([&count](Scope&) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      count.fetch_add(1);
+    });
+  });
+  EXPECT_EQ(count.load(), 1);
+}
+
+TEST(ThreadPool, Move) {
+  auto pool = ThreadPool::with_num_threads(2u);
+  auto moved = sus::move(pool);
+  EXPECT_EQ(moved.num_threads(), 2u);
+  auto [a, b] = moved.join([]() { return 1; }, []() { return 2; });
+  EXPECT_EQ(a + b, 3);
+
+  pool = ThreadPool::with_num_threads(1u);
+  moved = sus::move(pool);
+  EXPECT_EQ(moved.num_threads(), 1u);
+
+  // Moving into itself leaves the pool usable.
+  ThreadPool& alias = moved;
+  moved = sus::move(alias);
+  EXPECT_EQ(moved.num_threads(), 1u);
+  auto [c, d] = moved.join([]() { return 3; }, []() { return 4; });
+  EXPECT_EQ(c + d, 7);
+}
+
+TEST(ThreadPoolDeathTest, ZeroThreads) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(ThreadPool::with_num_threads(0u), "");
+#endif
+}
+
+}  // namespace